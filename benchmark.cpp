@@ -0,0 +1,1096 @@
+/**
+ * @file benchmark.cpp
+ * @brief Measure the operators of infPrecision over a logarithmic sweep of
+ * sizes, and print the results as CSV or JSON.
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2022
+ *
+ * Usage: benchmark [--format=csv|json] [--filter=TEXT] [--max-digits=N]
+ *                  [--max-mul-digits=N] [--min-time=SECONDS]
+ *        benchmark --verify[=PAIRS]
+ *
+ * Every case is run on random operands of 1, 3, 10, 30, ... digits up to
+ * --max-digits (10^7 by default). The superlinear operations (*, divmod and
+ * the bitwise operators) stop at --max-mul-digits (10^6 by default), and a
+ * few slow cases have lower limits of their own. The iterations of every
+ * measurement are repeated until they take at least --min-time seconds.
+ *
+ * With --verify, nothing is timed: every operation is cross-checked on
+ * random edge-biased pairs of integers against a slow reference built on
+ * decimal strings, and against __int128 for small values. One pair in 8
+ * also gets the long checks: long divisions, the bitwise operators, shifts
+ * and bit queries on long values, and round trips through infColumn,
+ * infDecimal, infFixed, infRNS, infSeries, the async operations and
+ * infDisk. Compiled with -DINFPRECISION_FUZZ -fsanitize=fuzzer, the same
+ * check is the libFuzzer target instead of the main function.
+ */
+
+#include <iostream>
+#include <sstream>
+#include <vector>
+#include <string>
+#include <chrono>
+#include <random>
+#include <functional>
+#include "infPrecision.hpp"
+#include "infAccumulator.hpp"
+#include "infReduce.hpp"
+#include "infDecimal.hpp"
+#include "infColumn.hpp"
+#include "infFixed.hpp"
+#include "infRNS.hpp"
+#include "infSeries.hpp"
+#include "infAsync.hpp"
+#if __has_include(<sys/mman.h>)
+#include "infDisk.hpp" // POSIX only
+#define BENCHMARK_DISK
+#endif
+using namespace std;
+
+/**
+ * @brief Settings of one run, read from the command line
+ *
+ */
+struct bench_options
+{
+    string format = "csv";
+    string filter;
+    uint64_t max_digits = 10000000;
+    uint64_t max_mul_digits = 1000000;
+    double min_time = 0.05;
+    uint64_t verify = 0; // pairs to cross-check instead of timing
+};
+
+/**
+ * @brief The result of one case at one size
+ *
+ */
+struct bench_result
+{
+    string name;
+    uint64_t digits;
+    uint64_t other_digits;
+    uint64_t iterations;
+    double ns_per_op;
+};
+
+/**
+ * @brief One benchmark case. The setup builds the operands for a size and
+ * returns the operation to be timed.
+ *
+ */
+struct bench_case
+{
+    string name;
+    bool superlinear;                                             // stops at max_mul_digits
+    uint64_t max_digits;                                          // 0 if only the global limits apply
+    function<uint64_t(uint64_t)> other;                           // size of the second operand
+    function<function<void()>(uint64_t, uint64_t)> setup;
+};
+
+mt19937_64 generator(20221019);
+volatile uint64_t sink = 0; // keeps the results alive
+
+/**
+ * @brief Make a random integer with exactly _digits digits
+ *
+ */
+string random_digits(uint64_t _digits, bool _negative)
+{
+    string str = _negative ? "-" : "";
+    str.reserve(_digits + 1);
+    str.push_back('1' + generator() % 9);
+    for (uint64_t i = 1; i < _digits; i++)
+    {
+        str.push_back('0' + generator() % 10);
+    }
+    return str;
+}
+
+infPrecision random_integer(uint64_t _digits, bool _negative = false)
+{
+    return infPrecision(random_digits(_digits, _negative));
+}
+
+/**
+ * @brief Time an operation, doubling the iterations until they take at
+ * least _min_time seconds
+ *
+ */
+pair<uint64_t, double> measure(const function<void()> &_op, double _min_time)
+{
+    for (uint64_t iterations = 1;; iterations *= 2)
+    {
+        auto start = chrono::steady_clock::now();
+        for (uint64_t i = 0; i < iterations; i++)
+        {
+            _op();
+        }
+        double seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+        if (seconds >= _min_time || iterations >= (uint64_t(1) << 40))
+        {
+            return make_pair(iterations, seconds * 1e9 / iterations);
+        }
+    }
+}
+
+/**
+ * @brief Get every benchmark case
+ *
+ */
+vector<bench_case> all_cases()
+{
+    auto same = [](uint64_t _n) { return _n; };
+    auto none = [](uint64_t) { return uint64_t(0); };
+    auto hundredth = [](uint64_t _n) { return max<uint64_t>(1, _n / 100); };
+    vector<bench_case> cases;
+
+    // Construction and insertion
+    cases.push_back({"construct/string", false, 0, none, [](uint64_t _n, uint64_t)
+                     {
+                         string str = random_digits(_n, true);
+                         return function<void()>([str]() { sink = sink + infPrecision(str).num_digits(); });
+                     }});
+    cases.push_back({"construct/int64", false, 18, none, [](uint64_t _n, uint64_t)
+                     {
+                         int64_t value = -stoll(random_digits(_n, false));
+                         return function<void()>([value]() { sink = sink + infPrecision(value).num_digits(); });
+                     }});
+    cases.push_back({"construct/vector", false, 0, none, [](uint64_t _n, uint64_t)
+                     {
+                         vector<int64_t> vec = random_integer(_n, true).get_vec();
+                         return function<void()>([vec]() mutable { sink = sink + infPrecision(vec).num_digits(); });
+                     }});
+    cases.push_back({"insertion", false, 0, none, [](uint64_t _n, uint64_t)
+                     {
+                         infPrecision x = random_integer(_n, true);
+                         return function<void()>([x]()
+                                                 {
+                                                     ostringstream out;
+                                                     out << x;
+                                                     sink = sink + out.tellp();
+                                                 });
+                     }});
+    cases.push_back({"extraction", false, 0, none, [](uint64_t _n, uint64_t)
+                     {
+                         string str = random_digits(_n, true);
+                         return function<void()>([str]()
+                                                 {
+                                                     istringstream in(str);
+                                                     infPrecision x;
+                                                     in >> x;
+                                                     sink = sink + x.num_digits();
+                                                 });
+                     }});
+
+    // Addition and subtraction
+    auto binary = [](function<infPrecision(const infPrecision &, const infPrecision &)> _op, bool _neg1, bool _neg2)
+    {
+        return [_op, _neg1, _neg2](uint64_t _n, uint64_t _m)
+        {
+            infPrecision x = random_integer(_n, _neg1), y = random_integer(_m, _neg2);
+            return function<void()>([_op, x, y]() { sink = sink + _op(x, y).num_digits(); });
+        };
+    };
+    auto add = [](const infPrecision &_a, const infPrecision &_b) { return _a + _b; };
+    auto sub = [](const infPrecision &_a, const infPrecision &_b) { return _a - _b; };
+    auto mul = [](const infPrecision &_a, const infPrecision &_b) { return _a * _b; };
+    cases.push_back({"add/same_sign", false, 0, same, binary(add, false, false)});
+    cases.push_back({"add/mixed_sign", false, 0, same, binary(add, true, false)});
+    cases.push_back({"add/unbalanced", false, 0, hundredth, binary(add, false, false)});
+    cases.push_back({"sub/same_sign", false, 0, same, binary(sub, false, false)});
+    cases.push_back({"sub/mixed_sign", false, 0, same, binary(sub, false, true)});
+
+    // Multiplication and division
+    cases.push_back({"mul/balanced", true, 0, same, binary(mul, true, false)});
+    cases.push_back({"mul/unbalanced", true, 0, hundredth, binary(mul, false, false)});
+    cases.push_back({"mul/by_limb", false, 0, [](uint64_t) { return uint64_t(9); }, binary(mul, false, true)});
+    cases.push_back({"divmod/balanced", true, 0, [](uint64_t _n) { return max<uint64_t>(1, _n / 2); },
+                     binary([](const infPrecision &_a, const infPrecision &_b) { return divmod(_a, _b).first; }, false, false)});
+    cases.push_back({"powmod", true, 1000, same, [](uint64_t _n, uint64_t)
+                     {
+                         infPrecision base = random_integer(_n), exp = random_integer(_n), mod = random_integer(_n);
+                         return function<void()>([base, exp, mod]() { sink = sink + powmod(base, exp, mod).num_digits(); });
+                     }});
+
+    // Comparisons, hashing, increment and decrement
+    cases.push_back({"compare/equal", false, 0, same, [](uint64_t _n, uint64_t)
+                     {
+                         infPrecision x = random_integer(_n, true), y = x;
+                         return function<void()>([x, y]() { sink = sink + (x == y); });
+                     }});
+    cases.push_back({"compare/less", false, 0, same, [](uint64_t _n, uint64_t)
+                     {
+                         infPrecision x = random_integer(_n, true), y = x - infPrecision(1);
+                         return function<void()>([x, y]() { sink = sink + (x < y); });
+                     }});
+    cases.push_back({"hash", false, 0, none, [](uint64_t _n, uint64_t)
+                     {
+                         infPrecision x = random_integer(_n, true);
+                         return function<void()>([x]() { sink = sink + hash<infPrecision>()(x); });
+                     }});
+    cases.push_back({"increment", false, 0, none, [](uint64_t _n, uint64_t)
+                     {
+                         infPrecision x = random_integer(_n);
+                         return function<void()>([x]() mutable { sink = sink + (++x).num_digits(); });
+                     }});
+    cases.push_back({"decrement", false, 0, none, [](uint64_t _n, uint64_t)
+                     {
+                         infPrecision x = random_integer(_n);
+                         return function<void()>([x]() mutable { sink = sink + (--x).num_digits(); });
+                     }});
+
+    // Shifts, bitwise operators and the accumulator
+    cases.push_back({"shift/left", true, 0, none, [](uint64_t _n, uint64_t)
+                     {
+                         infPrecision x = random_integer(_n, true);
+                         return function<void()>([x]() { sink = sink + (x << 64).num_digits(); });
+                     }});
+    // The operands are converted to binary and back by divide and conquer,
+    // so & costs about three multiplications (3.4 s for 10^6 digits) and
+    // goes as far as the other superlinear operations
+    cases.push_back({"bitwise/and", true, 0, same, binary([](const infPrecision &_a, const infPrecision &_b) { return _a & _b; }, true, false)});
+    cases.push_back({"accumulator/add", false, 0, none, [](uint64_t _n, uint64_t)
+                     {
+                         infPrecision x = random_integer(_n, true);
+                         infAccumulator acc;
+                         return function<void()>([x, acc]() mutable { acc += x; });
+                     }});
+
+    // Reductions: 100 terms of _n digits, and the product of 100-digit
+    // factors with _n digits in total
+    cases.push_back({"reduce/sum", false, 1000000, none, [](uint64_t _n, uint64_t)
+                     {
+                         vector<infPrecision> terms;
+                         for (int i = 0; i < 100; i++)
+                         {
+                             terms.push_back(random_integer(_n, true));
+                         }
+                         return function<void()>([terms]() { sink = sink + sum(terms).num_digits(); });
+                     }});
+    cases.push_back({"reduce/product", true, 0, none, [](uint64_t _n, uint64_t)
+                     {
+                         vector<infPrecision> factors;
+                         for (uint64_t i = 0; i < max<uint64_t>(_n / 100, 1); i++)
+                         {
+                             factors.push_back(random_integer(min<uint64_t>(_n, 100)));
+                         }
+                         return function<void()>([factors]() { sink = sink + product(factors).num_digits(); });
+                     }});
+
+    // Decimals with _n digits, half of them after the point
+    cases.push_back({"decimal/parse", false, 0, none, [](uint64_t _n, uint64_t)
+                     {
+                         string str = random_digits(_n, true);
+                         if (_n >= 2)
+                         {
+                             str.insert(str.size() - _n / 2, ".");
+                         }
+                         return function<void()>([str]() { sink = sink + infDecimal(str).get_scale(); });
+                     }});
+    cases.push_back({"decimal/mul_rescale", true, 0, same, [](uint64_t _n, uint64_t)
+                     {
+                         infDecimal x(random_integer(_n, true), _n / 2), y(random_integer(_n, false), _n / 2);
+                         return function<void()>([x, y]()
+                                                 {
+                                                     infDecimal product = x * y;
+                                                     sink = sink + product.rescale(x.get_scale()).get_scale();
+                                                 });
+                     }});
+
+    // Columns of 10-digit integers with _n digits in total, one per line
+    cases.push_back({"column/parse", false, 0, none, [](uint64_t _n, uint64_t)
+                     {
+                         string buffer;
+                         for (uint64_t i = 0; i < max<uint64_t>(_n / 10, 1); i++)
+                         {
+                             buffer += random_digits(min<uint64_t>(_n, 10), true) + "\n";
+                         }
+                         return function<void()>([buffer]() { sink = sink + infColumn::parse(buffer).size(); });
+                     }});
+    cases.push_back({"column/format", false, 0, none, [](uint64_t _n, uint64_t)
+                     {
+                         infColumn column;
+                         for (uint64_t i = 0; i < max<uint64_t>(_n / 10, 1); i++)
+                         {
+                             column.push_back(random_integer(min<uint64_t>(_n, 10), true));
+                         }
+                         return function<void()>([column]() { sink = sink + column.format().size(); });
+                     }});
+    return cases;
+}
+
+/**
+ * @brief Read the command line into the options
+ *
+ * @return bool Return false if an argument is not recognized
+ */
+bool parse_options(int _argc, char **_argv, bench_options &_options)
+{
+    for (int i = 1; i < _argc; i++)
+    {
+        string arg = _argv[i];
+        string key = arg.substr(0, arg.find('='));
+        string value = arg.find('=') == string::npos ? "" : arg.substr(arg.find('=') + 1);
+        if (key == "--format" && (value == "csv" || value == "json"))
+        {
+            _options.format = value;
+        }
+        else if (key == "--filter")
+        {
+            _options.filter = value;
+        }
+        else if (key == "--max-digits" && !value.empty())
+        {
+            _options.max_digits = stoull(value);
+        }
+        else if (key == "--max-mul-digits" && !value.empty())
+        {
+            _options.max_mul_digits = stoull(value);
+        }
+        else if (key == "--min-time" && !value.empty())
+        {
+            _options.min_time = stod(value);
+        }
+        else if (key == "--verify")
+        {
+            _options.verify = value.empty() ? 100000 : stoull(value);
+        }
+        else
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Print all results as CSV, one row for every case and size
+ *
+ */
+void print_csv(const vector<bench_result> &_results)
+{
+    cout << "name,digits,other_digits,iterations,ns_per_op\n";
+    for (const bench_result &r : _results)
+    {
+        cout << r.name << "," << r.digits << "," << r.other_digits << "," << r.iterations << "," << r.ns_per_op << "\n";
+    }
+}
+
+/**
+ * @brief Print all results as JSON, in the layout of Google Benchmark
+ *
+ */
+void print_json(const vector<bench_result> &_results, const bench_options &_options)
+{
+    cout << "{\n  \"context\": {\"library\": \"infPrecision\", \"min_time\": " << _options.min_time
+         << ", \"karatsuba_threshold\": " << INFPRECISION_KARATSUBA_THRESHOLD << "},\n  \"benchmarks\": [\n";
+    for (uint64_t i = 0; i < _results.size(); i++)
+    {
+        const bench_result &r = _results[i];
+        cout << "    {\"name\": \"" << r.name << "/" << r.digits << "\", \"digits\": " << r.digits
+             << ", \"other_digits\": " << r.other_digits << ", \"iterations\": " << r.iterations
+             << ", \"real_time\": " << r.ns_per_op << ", \"time_unit\": \"ns\"}"
+             << (i + 1 < _results.size() ? "," : "") << "\n";
+    }
+    cout << "  ]\n}\n";
+}
+
+/**
+ * @brief Slow reference arithmetic on decimal strings, written independently
+ * of infPrecision, for the cross-check of --verify. A magnitude is a string
+ * of digits without leading zeros; a signed value also has a sign flag.
+ *
+ */
+namespace reference
+{
+    struct value
+    {
+        bool negative;
+        string digits;
+    };
+
+    value parse(const string &_str)
+    {
+        if (!_str.empty() && _str[0] == '-')
+        {
+            return {true, _str.substr(1)};
+        }
+        return {false, _str};
+    }
+
+    string print(const value &_v)
+    {
+        return (_v.negative && _v.digits != "0" ? "-" : "") + _v.digits;
+    }
+
+    string strip(const string &_digits)
+    {
+        uint64_t first = 0;
+        while (first + 1 < _digits.size() && _digits[first] == '0')
+        {
+            first++;
+        }
+        return _digits.substr(first);
+    }
+
+    int compare(const string &_a, const string &_b)
+    {
+        if (_a.size() != _b.size())
+        {
+            return _a.size() < _b.size() ? -1 : 1;
+        }
+        return _a < _b ? -1 : (_a > _b ? 1 : 0);
+    }
+
+    string add(const string &_a, const string &_b)
+    {
+        string sum;
+        int carry = 0;
+        for (uint64_t i = 0; i < max(_a.size(), _b.size()) || carry; i++)
+        {
+            int d = carry;
+            d += i < _a.size() ? _a[_a.size() - 1 - i] - '0' : 0;
+            d += i < _b.size() ? _b[_b.size() - 1 - i] - '0' : 0;
+            sum.push_back('0' + d % 10);
+            carry = d / 10;
+        }
+        reverse(sum.begin(), sum.end());
+        return strip(sum);
+    }
+
+    // _a must not be smaller than _b
+    string sub(const string &_a, const string &_b)
+    {
+        string diff;
+        int borrow = 0;
+        for (uint64_t i = 0; i < _a.size(); i++)
+        {
+            int d = (_a[_a.size() - 1 - i] - '0') - borrow - (i < _b.size() ? _b[_b.size() - 1 - i] - '0' : 0);
+            borrow = d < 0;
+            diff.push_back('0' + d + 10 * borrow);
+        }
+        reverse(diff.begin(), diff.end());
+        return strip(diff);
+    }
+
+    string mul(const string &_a, const string &_b)
+    {
+        vector<uint64_t> cols(_a.size() + _b.size(), 0);
+        for (uint64_t i = 0; i < _a.size(); i++)
+        {
+            for (uint64_t j = 0; j < _b.size(); j++)
+            {
+                cols[i + j + 1] += (_a[i] - '0') * (_b[j] - '0');
+            }
+        }
+        for (uint64_t k = cols.size(); k-- > 1;)
+        {
+            cols[k - 1] += cols[k] / 10;
+            cols[k] %= 10;
+        }
+        string product;
+        for (uint64_t c : cols)
+        {
+            product.push_back('0' + c);
+        }
+        return strip(product);
+    }
+
+    // Long division digit by digit, _b must not be 0
+    pair<string, string> divmod(const string &_a, const string &_b)
+    {
+        string quotient, rem = "0";
+        for (char c : _a)
+        {
+            rem = strip(rem + c);
+            int q = 0;
+            while (compare(rem, _b) >= 0)
+            {
+                rem = sub(rem, _b);
+                q++;
+            }
+            quotient.push_back('0' + q);
+        }
+        return make_pair(strip(quotient), rem);
+    }
+
+    value add(const value &_x, const value &_y)
+    {
+        if (_x.negative == _y.negative)
+        {
+            return {_x.negative, add(_x.digits, _y.digits)};
+        }
+        if (compare(_x.digits, _y.digits) >= 0)
+        {
+            return {_x.negative, sub(_x.digits, _y.digits)};
+        }
+        return {_y.negative, sub(_y.digits, _x.digits)};
+    }
+
+    int compare(const value &_x, const value &_y)
+    {
+        bool neg_x = _x.negative && _x.digits != "0", neg_y = _y.negative && _y.digits != "0";
+        if (neg_x != neg_y)
+        {
+            return neg_x ? -1 : 1;
+        }
+        return neg_x ? -compare(_x.digits, _y.digits) : compare(_x.digits, _y.digits);
+    }
+
+    // _digits * _m + _a, for _m and _a below 2^32
+    string mul_add(const string &_digits, uint64_t _m, uint64_t _a)
+    {
+        string result;
+        uint64_t carry = _a;
+        for (uint64_t i = _digits.size(); i-- > 0;)
+        {
+            uint64_t d = (_digits[i] - '0') * _m + carry;
+            result.push_back('0' + d % 10);
+            carry = d / 10;
+        }
+        for (; carry > 0; carry /= 10)
+        {
+            result.push_back('0' + carry % 10);
+        }
+        reverse(result.begin(), result.end());
+        return strip(result);
+    }
+
+    // Divide _digits in place by _d below 2^32 and return the remainder
+    uint64_t div_small(string &_digits, uint64_t _d)
+    {
+        uint64_t rem = 0;
+        for (char &c : _digits)
+        {
+            uint64_t d = rem * 10 + (c - '0');
+            c = '0' + d / _d;
+            rem = d % _d;
+        }
+        _digits = strip(_digits);
+        return rem;
+    }
+
+    // 2^_k as a magnitude
+    string pow2(uint64_t _k)
+    {
+        string power = "1";
+        for (uint64_t i = 0; i < _k / 16; i++)
+        {
+            power = mul_add(power, 1 << 16, 0);
+        }
+        return mul_add(power, 1 << (_k % 16), 0);
+    }
+
+    // The binary digits of a magnitude, from the least significant one,
+    // none for 0
+    vector<int> to_bits(string _digits)
+    {
+        vector<int> bits;
+        while (_digits != "0")
+        {
+            uint64_t chunk = div_small(_digits, 1 << 16);
+            for (int j = 0; j < 16; j++)
+            {
+                bits.push_back((chunk >> j) & 1);
+            }
+        }
+        while (!bits.empty() && bits.back() == 0)
+        {
+            bits.pop_back();
+        }
+        return bits;
+    }
+
+    string from_bits(const vector<int> &_bits)
+    {
+        // 16 bits at a time, from the most significant ones
+        string digits = "0";
+        for (uint64_t hi = _bits.size(); hi > 0;)
+        {
+            uint64_t lo = hi >= 16 ? hi - 16 : 0, chunk = 0;
+            for (uint64_t i = hi; i-- > lo;)
+            {
+                chunk = 2 * chunk + _bits[i];
+            }
+            digits = mul_add(digits, (uint64_t)1 << (hi - lo), chunk);
+            hi = lo;
+        }
+        return digits;
+    }
+
+    // The two's complement form of a value in _width bits, negated by
+    // flipping every bit and adding 1
+    vector<int> twos_complement(const value &_v, uint64_t _width)
+    {
+        vector<int> bits = to_bits(_v.digits);
+        bits.resize(_width, 0);
+        if (_v.negative)
+        {
+            int carry = 1;
+            for (int &bit : bits)
+            {
+                int sum = (1 - bit) + carry;
+                bit = sum % 2;
+                carry = sum / 2;
+            }
+        }
+        return bits;
+    }
+
+    value from_twos_complement(vector<int> _bits)
+    {
+        bool negative = !_bits.empty() && _bits.back() == 1;
+        if (negative)
+        {
+            int carry = 1;
+            for (int &bit : _bits)
+            {
+                int sum = (1 - bit) + carry;
+                bit = sum % 2;
+                carry = sum / 2;
+            }
+        }
+        return {negative, from_bits(_bits)};
+    }
+
+    // The quotient _x / _y rounded toward negative infinity, _y must not be 0
+    value floor_div(const value &_x, const value &_y)
+    {
+        pair<string, string> qr = divmod(_x.digits, _y.digits);
+        bool negative = _x.negative != _y.negative && _x.digits != "0";
+        if (negative && qr.second != "0")
+        {
+            qr.first = add(qr.first, "1");
+        }
+        return {negative, qr.first};
+    }
+}
+
+/**
+ * @brief Make an edge-biased random integer for --verify: zero, one, runs
+ * of 9s that carry through every digit, powers of ten and of 10^9 (limb
+ * boundaries), or random digits with lengths around the Karatsuba threshold
+ *
+ */
+string edge_integer()
+{
+    uint64_t kind = generator() % 8;
+    uint64_t len = 1 + generator() % (generator() % 4 == 0 ? 2000 : 40);
+    string str;
+    if (kind == 0)
+    {
+        str = generator() % 2 ? "0" : "1";
+    }
+    else if (kind == 1)
+    {
+        str = string(len, '9');
+    }
+    else if (kind == 2)
+    {
+        str = "1" + string(len - 1, '0');
+    }
+    else if (kind == 3)
+    {
+        str = "1" + string(9 * (1 + generator() % 60), '0'); // 10^(9k)
+    }
+    else if (kind == 4)
+    {
+        str = string(9 * (1 + generator() % 60), '9'); // 10^(9k) - 1
+    }
+    else
+    {
+        str = random_digits(len, false);
+    }
+    return (str != "0" && generator() % 2) ? "-" + str : str;
+}
+
+/**
+ * @brief Print a value through its operator << for the comparisons of
+ * --verify
+ *
+ */
+template <class T>
+string text(const T &_value)
+{
+    ostringstream out;
+    out << _value;
+    return out.str();
+}
+
+/**
+ * @brief Describe the mismatch of one operation on a pair of integers
+ *
+ * @return string Empty if _got is _want, otherwise the mismatch
+ */
+string mismatch(const string &_name, const string &_x, const string &_y, const string &_got, const string &_want)
+{
+    return _got == _want ? string() : _name + "(" + _x + ", " + _y + ") = " + _got + ", expected " + _want;
+}
+
+/**
+ * @brief Cross-check the bitwise operators, the shifts, the bit queries and
+ * powmod on long integers, where they convert between limbs and words by
+ * divide and conquer, against bit vectors and powers of 2 built by the
+ * decimal reference
+ *
+ */
+void verify_bits(const string &_x, const string &_y, mt19937_64 &_generator, vector<string> &_failures)
+{
+    using reference::value;
+    infPrecision x(_x), y(_y);
+    value rx = reference::parse(_x), ry = reference::parse(_y);
+    auto check = [&](const string &_name, const string &_got, const string &_want)
+    {
+        _failures.push_back(mismatch(_name, _x, _y, _got, _want));
+    };
+
+    vector<int> bits_x = reference::to_bits(rx.digits), bits_y = reference::to_bits(ry.digits);
+    uint64_t width = max(bits_x.size(), bits_y.size()) + 1;
+    vector<int> tx = reference::twos_complement(rx, width), ty = reference::twos_complement(ry, width);
+    vector<int> and_bits(width), or_bits(width), xor_bits(width);
+    for (uint64_t i = 0; i < width; i++)
+    {
+        and_bits[i] = tx[i] & ty[i];
+        or_bits[i] = tx[i] | ty[i];
+        xor_bits[i] = tx[i] ^ ty[i];
+    }
+    check("and", text(x & y), reference::print(reference::from_twos_complement(and_bits)));
+    check("or", text(x | y), reference::print(reference::from_twos_complement(or_bits)));
+    check("xor", text(x ^ y), reference::print(reference::from_twos_complement(xor_bits)));
+    check("popcount", to_string(x.popcount()), to_string(count(bits_x.begin(), bits_x.end(), 1)));
+    check("bit_length", to_string(x.bit_length()), to_string(bits_x.size()));
+
+    uint64_t k = _generator() % 4000;
+    vector<int> bits_k = reference::twos_complement(rx, max<uint64_t>(bits_x.size(), k + 1) + 1);
+    check("test_bit", to_string(x.test_bit(k)), to_string(bits_k[k]));
+    bits_k[k] = _generator() % 2;
+    check("set_bit", text(infPrecision(x).set_bit(k, bits_k[k])), reference::print(reference::from_twos_complement(bits_k)));
+
+    string power = reference::pow2(k);
+    check("shift_left", text(x << k), reference::print({rx.negative, reference::mul(rx.digits, power)}));
+    check("shift_right", text(x >> k), reference::print(reference::floor_div(rx, {false, power})));
+
+    // Every step of powmod costs a reference product and division, so the
+    // exponent and the modulus are short
+    if (!ry.negative && ry.digits != "0" && ry.digits.size() <= 300)
+    {
+        uint64_t e = _generator() % 100;
+        string base = reference::divmod(rx.digits, ry.digits).second;
+        if (rx.negative && base != "0")
+        {
+            base = reference::sub(ry.digits, base);
+        }
+        string result = reference::divmod("1", ry.digits).second;
+        for (uint64_t bit = 7; bit-- > 0;)
+        {
+            result = reference::divmod(reference::mul(result, result), ry.digits).second;
+            if ((e >> bit) & 1)
+            {
+                result = reference::divmod(reference::mul(result, base), ry.digits).second;
+            }
+        }
+        check("powmod_long", text(powmod(x, infPrecision((int64_t)e), y)), result);
+    }
+}
+
+/**
+ * @brief Cross-check the types built on infPrecision by round trips and
+ * products: infColumn, infDecimal, infFixed, infRNS, infSeries, the
+ * asynchronous operations and infDisk
+ *
+ */
+void verify_types(const string &_x, const string &_y, mt19937_64 &_generator, vector<string> &_failures)
+{
+    using reference::value;
+    infPrecision x(_x), y(_y);
+    value rx = reference::parse(_x), ry = reference::parse(_y);
+    value product = {rx.negative != ry.negative, reference::mul(rx.digits, ry.digits)};
+    auto check = [&](const string &_name, const string &_got, const string &_want)
+    {
+        _failures.push_back(mismatch(_name, _x, _y, _got, _want));
+    };
+
+    infColumn column = infColumn::parse(_x + "," + _y, ',');
+    check("column", column.format(';') + text(column[0]) + "," + text(column[1]), _x + ";" + _y + ";" + _x + "," + _y);
+
+    // A decimal with _scale digits after the point, written by the reference
+    auto decimal_text = [](const value &_v, uint64_t _scale)
+    {
+        string digits = string(_v.digits.size() <= _scale ? _scale + 1 - _v.digits.size() : 0, '0') + _v.digits;
+        string str = _scale == 0 ? digits : digits.substr(0, digits.size() - _scale) + "." + digits.substr(digits.size() - _scale);
+        return (_v.negative && _v.digits != "0" ? "-" : "") + str;
+    };
+    uint64_t scale_x = _generator() % 12, scale_y = _generator() % 12;
+    infDecimal dx(decimal_text(rx, scale_x)), dy(y, scale_y);
+    check("decimal", text(dx), decimal_text(rx, scale_x));
+    check("decimal_mul", text(dx * dy), decimal_text(product, scale_x + scale_y));
+    check("decimal_floor", text(dx.to_infPrecision(ROUND_FLOOR)),
+          reference::print(reference::floor_div(rx, {false, "1" + string(scale_x, '0')})));
+
+    // |x| < 2^255 fits in the signed 256-bit integers
+    if (x.bit_length() < 256 && y.bit_length() < 256)
+    {
+        infFixed<256> fx(x), fy(y);
+        check("fixed", text(fx.to_infPrecision()), _x);
+        if (x.bit_length() + y.bit_length() < 256)
+        {
+            check("fixed_mul", text((fx * fy).to_infPrecision()), reference::print(product));
+        }
+    }
+
+    // The pairs have at most 2000 digits each
+    static shared_ptr<const infRNSBasis> basis = make_shared<infRNSBasis>(4200);
+    infRNS nx(x, basis), ny(y, basis);
+    check("rns", text((nx * ny + nx).to_infPrecision()), reference::print(reference::add(product, rx)));
+
+    check("async_mul", text(async_mul(x, y).get()), reference::print(product));
+    if (ry.digits != "0")
+    {
+        pair<infPrecision, infPrecision> qr = async_divmod(x, y).get(), want = divmod(x, y);
+        check("async_divmod", text(qr.first) + "," + text(qr.second), text(want.first) + "," + text(want.second));
+
+        // x / y + 1 / y in two terms, rounded toward negative infinity
+        infSeries series([](uint64_t)
+                         { return infPrecision(1); },
+                         [y](uint64_t _n)
+                         { return _n == 0 ? y : infPrecision(1); },
+                         [x](uint64_t _n)
+                         { return _n == 0 ? x : infPrecision(1); });
+        check("series", text(series.fixed_point(2, 0)), reference::print(reference::floor_div(reference::add(rx, {false, "1"}), ry)));
+    }
+
+#ifdef BENCHMARK_DISK
+    infDiskOptions options;
+    options.memory_budget = 64 * 64; // segments of 64 limbs
+    infDisk kx(x, options), ky(y, options);
+    check("disk_mul", text((kx * ky).to_infPrecision()), reference::print(product));
+    check("disk_add", text((kx + ky).to_infPrecision()), reference::print(reference::add(rx, ry)));
+#endif
+}
+
+/**
+ * @brief Cross-check every operation on one pair of integers against the
+ * reference arithmetic, and against __int128 when both are small
+ *
+ * @param _x The first integer as a string
+ * @param _y The second integer as a string
+ * @return string Empty if everything agrees, otherwise the first mismatch
+ */
+string verify_pair(const string &_x, const string &_y)
+{
+    using reference::value;
+    infPrecision x(_x), y(_y);
+    value rx = reference::parse(_x), ry = reference::parse(_y);
+    value neg_ry = {!ry.negative, ry.digits};
+    auto str = [](const infPrecision &_infP)
+    {
+        ostringstream out;
+        out << _infP;
+        return out.str();
+    };
+    auto check = [&](const string &_name, const string &_got, const string &_want)
+    {
+        return mismatch(_name, _x, _y, _got, _want);
+    };
+
+    vector<string> failures;
+    failures.push_back(check("construct", str(x), _x));
+    failures.push_back(check("add", str(x + y), reference::print(reference::add(rx, ry))));
+    failures.push_back(check("sub", str(x - y), reference::print(reference::add(rx, neg_ry))));
+    failures.push_back(check("mul", str(x * y), reference::print({rx.negative != ry.negative, reference::mul(rx.digits, ry.digits)})));
+    failures.push_back(check("negate", str(-x), reference::print({!rx.negative, rx.digits})));
+    failures.push_back(check("increment", str(++infPrecision(x)), reference::print(reference::add(rx, {false, "1"}))));
+    failures.push_back(check("decrement", str(--infPrecision(x)), reference::print(reference::add(rx, {true, "1"}))));
+
+    int order = reference::compare(rx, ry);
+    string want = to_string(order < 0) + to_string(order <= 0) + to_string(order > 0) +
+                  to_string(order >= 0) + to_string(order == 0) + to_string(order != 0);
+    string got = to_string(x < y) + to_string(x <= y) + to_string(x > y) +
+                 to_string(x >= y) + to_string(x == y) + to_string(x != y);
+    failures.push_back(check("compare", got, want));
+    // Equal integers built in different ways must have equal hashes
+    infPrecision parsed(str(x));
+    failures.push_back(check("hash", to_string(hash<infPrecision>()(parsed) == hash<infPrecision>()(x)), "1"));
+
+    // The random choices of the checks come from a generator seeded by the
+    // pair, so a mismatch found by the fuzzer is reproduced by the pair alone
+    mt19937_64 pair_generator(hash<string>()(_x) ^ hash<string>()(_y));
+
+    // The long checks take a few milliseconds, as the reference is
+    // quadratic, so they run on one pair in 8
+    bool long_checks = pair_generator() % 8 == 0;
+
+    // Long divisors, beyond 33 limbs, reach the multi-limb long division
+    if (ry.digits != "0" && (rx.digits.size() + ry.digits.size() < 600 || long_checks))
+    {
+        pair<string, string> qr = reference::divmod(rx.digits, ry.digits);
+        pair<infPrecision, infPrecision> result = divmod(x, y);
+        failures.push_back(check("quotient", str(result.first), reference::print({rx.negative != ry.negative, qr.first})));
+        failures.push_back(check("remainder", str(result.second), reference::print({rx.negative, qr.second})));
+    }
+
+    // Small values are also checked against __int128, including the
+    // bitwise operators which the decimal reference does not have
+    if (rx.digits.size() <= 18 && ry.digits.size() <= 18)
+    {
+        __int128 a = stoll(_x), b = stoll(_y);
+        auto print128 = [](__int128 _v)
+        {
+            string digits;
+            unsigned __int128 m = _v < 0 ? -(unsigned __int128)_v : _v;
+            do
+            {
+                digits.push_back('0' + m % 10);
+                m /= 10;
+            } while (m > 0);
+            reverse(digits.begin(), digits.end());
+            return (_v < 0 ? "-" : "") + digits;
+        };
+        uint64_t k = pair_generator() % 60;
+        failures.push_back(check("and", str(x & y), print128(a & b)));
+        failures.push_back(check("or", str(x | y), print128(a | b)));
+        failures.push_back(check("xor", str(x ^ y), print128(a ^ b)));
+        failures.push_back(check("not", str(~x), print128(~a)));
+        failures.push_back(check("shift_left", str(x << k), print128(a * ((__int128)1 << k))));
+        failures.push_back(check("shift_right", str(x >> k), print128(a >> k))); // floor for negative
+        if (b > 0)
+        {
+            __int128 e = a < 0 ? -a : a, base = ((a % b) + b) % b, p = 1 % b;
+            for (__int128 bit = e; bit > 0; bit >>= 1, base = base * base % b)
+            {
+                p = (bit & 1) ? p * base % b : p;
+            }
+            failures.push_back(check("powmod", str(powmod(infPrecision(print128(a)), infPrecision(print128(e)), y)), print128(p)));
+        }
+    }
+
+    if (long_checks && rx.digits.size() <= 1200 && ry.digits.size() <= 1200)
+    {
+        verify_bits(_x, _y, pair_generator, failures);
+    }
+    if (long_checks)
+    {
+        verify_types(_x, _y, pair_generator, failures);
+    }
+
+    for (const string &failure : failures)
+    {
+        if (!failure.empty())
+        {
+            return failure;
+        }
+    }
+    return "";
+}
+
+/**
+ * @brief Cross-check _pairs random edge-biased pairs of integers
+ *
+ * @return int 0 if every operation agrees with the reference, 1 otherwise
+ */
+int run_verify(uint64_t _pairs)
+{
+    for (uint64_t i = 0; i < _pairs; i++)
+    {
+        string failure = verify_pair(edge_integer(), edge_integer());
+        if (!failure.empty())
+        {
+            cerr << "Mismatch: " << failure << "\n";
+            return 1;
+        }
+    }
+    cout << "Verified " << _pairs << " pairs of integers\n";
+    return 0;
+}
+
+#ifdef INFPRECISION_FUZZ
+/**
+ * @brief Entry point for libFuzzer. The first byte picks the signs and the
+ * split point, and every following byte becomes one decimal digit.
+ *
+ */
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t *_data, size_t _size)
+{
+    if (_size < 2)
+    {
+        return 0;
+    }
+    string digits;
+    for (size_t i = 1; i < _size; i++)
+    {
+        digits.push_back('0' + _data[i] % 10);
+    }
+    uint64_t split = (_data[0] >> 2) % digits.size();
+    string x = reference::strip(digits.substr(0, split + 1)), y = reference::strip(digits.substr(split + 1).empty() ? "0" : digits.substr(split + 1));
+    x = (_data[0] & 1) && x != "0" ? "-" + x : x;
+    y = (_data[0] & 2) && y != "0" ? "-" + y : y;
+    string failure = verify_pair(x, y);
+    if (!failure.empty())
+    {
+        cerr << "Mismatch: " << failure << "\n";
+        abort();
+    }
+    return 0;
+}
+#endif
+
+#ifndef INFPRECISION_FUZZ
+int main(int argc, char **argv)
+{
+    bench_options options;
+    if (!parse_options(argc, argv, options))
+    {
+        cerr << "Usage: benchmark [--format=csv|json] [--filter=TEXT] [--max-digits=N]\n"
+             << "                 [--max-mul-digits=N] [--min-time=SECONDS]\n"
+             << "       benchmark --verify[=PAIRS]\n";
+        return 1;
+    }
+    if (options.verify > 0)
+    {
+        return run_verify(options.verify);
+    }
+
+    vector<bench_result> results;
+    for (const bench_case &c : all_cases())
+    {
+        if (c.name.find(options.filter) == string::npos)
+        {
+            continue;
+        }
+        uint64_t limit = c.superlinear ? min(options.max_digits, options.max_mul_digits) : options.max_digits;
+        if (c.max_digits > 0)
+        {
+            limit = min(limit, c.max_digits);
+        }
+
+        // 1, 3, 10, 30, 100, ... digits
+        for (uint64_t decade = 1; decade <= limit; decade *= 10)
+        {
+            for (uint64_t n : {decade, 3 * decade})
+            {
+                if (n > limit)
+                {
+                    continue;
+                }
+                uint64_t m = c.other(n);
+                function<void()> op = c.setup(n, m);
+                pair<uint64_t, double> timing = measure(op, options.min_time);
+                results.push_back({c.name, n, m, timing.first, timing.second});
+                cerr << c.name << "/" << n << ": " << timing.second << " ns\n";
+            }
+        }
+    }
+
+    if (options.format == "json")
+    {
+        print_json(results, options);
+    }
+    else
+    {
+        print_csv(results);
+    }
+}
+#endif
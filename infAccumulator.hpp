@@ -0,0 +1,213 @@
+/**
+ * @file infAccumulator.hpp
+ * @brief Construct an accumulator for long chains of additions of infinite
+ * precision integers. The limbs are kept in a redundant form, so the carries
+ * are only resolved when the value is read.
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2022
+ *
+ */
+
+#ifndef INFACCUMULATOR_HPP
+#define INFACCUMULATOR_HPP
+
+#include "infPrecision.hpp"
+
+/**
+ * @brief Construct an accumulator of infPrecision objects. The sum is stored
+ * in base 10^9 limbs held by 64-bit words, from the least significant limb.
+ * A limb may grow above 10^9; the headroom above it absorbs about 10^10
+ * additions (or several products by a limb) before the carries have to be
+ * resolved. Positive and negative terms are kept in two separate sums, so
+ * no borrow is ever needed until the value is read.
+ *
+ */
+class infAccumulator
+{
+    // A limb is normalized before it could exceed this bound, so the carry
+    // into it can never overflow 64 bits
+    static const uint64_t LIMB_LIMIT = UINT64_MAX / 2;
+
+    vector<uint64_t> positive; // sum of the positive terms
+    vector<uint64_t> negative; // sum of the magnitudes of the negative terms
+    uint64_t bound = 0;        // upper bound of every limb in both sums
+
+    /**
+     * @brief Make room for an increase of every limb by _increase, by
+     * resolving the carries first if a limb could exceed LIMB_LIMIT
+     *
+     */
+    void reserve_headroom(uint64_t _increase)
+    {
+        if (bound + _increase > LIMB_LIMIT)
+        {
+            normalize();
+        }
+        bound += _increase;
+    }
+
+    /**
+     * @brief Resolve the carries of one sum, so every limb is below 10^9
+     *
+     */
+    static void carry_sum(vector<uint64_t> &_sum)
+    {
+        uint64_t carry = 0;
+        for (uint64_t i = 0; i < _sum.size(); i++)
+        {
+            uint64_t cur = _sum[i] + carry;
+            _sum[i] = cur % infPrecision_detail::LIMB_BASE;
+            carry = cur / infPrecision_detail::LIMB_BASE;
+        }
+        while (carry > 0)
+        {
+            _sum.push_back(carry % infPrecision_detail::LIMB_BASE);
+            carry /= infPrecision_detail::LIMB_BASE;
+        }
+    }
+
+    /**
+     * @brief Add _limbs * _m to one sum without carrying
+     *
+     */
+    static void add_to_sum(vector<uint64_t> &_sum, const vector<uint32_t> &_limbs, uint64_t _m)
+    {
+        if (_sum.size() < _limbs.size())
+        {
+            _sum.resize(_limbs.size(), 0);
+        }
+        for (uint64_t i = 0; i < _limbs.size(); i++)
+        {
+            _sum[i] += _limbs[i] * _m;
+        }
+    }
+
+    /**
+     * @brief Get one sum as normalized limbs, without changing the accumulator
+     *
+     */
+    static vector<uint32_t> sum_to_limbs(vector<uint64_t> _sum)
+    {
+        carry_sum(_sum);
+        vector<uint32_t> limbs(_sum.begin(), _sum.end());
+        if (limbs.empty())
+        {
+            limbs.push_back(0);
+        }
+        infPrecision_detail::trim_limbs(limbs);
+        return limbs;
+    }
+
+public:
+    /**
+     * @brief Construct a default infAccumulator object with integer 0
+     *
+     */
+    infAccumulator() {}
+
+    /**
+     * @brief Construct a new infAccumulator object starting from a
+     * infPrecision object
+     *
+     * @param _infP The initial value
+     */
+    explicit infAccumulator(const infPrecision &_infP)
+    {
+        *this += _infP;
+    }
+
+    /**
+     * @brief Add a infPrecision object to the accumulator without resolving
+     * the carries
+     *
+     * @param _infP The integer to be added
+     * @return infAccumulator& The accumulator itself
+     */
+    infAccumulator &operator+=(const infPrecision &_infP)
+    {
+        return add_product(_infP, 1);
+    }
+
+    /**
+     * @brief Subtract a infPrecision object from the accumulator without
+     * resolving the carries
+     *
+     * @param _infP The integer to be subtracted
+     * @return infAccumulator& The accumulator itself
+     */
+    infAccumulator &operator-=(const infPrecision &_infP)
+    {
+        return add_product(_infP, -1);
+    }
+
+    /**
+     * @brief Add the product of a infPrecision object and a small integer to
+     * the accumulator without resolving the carries. A factor with more than
+     * 9 digits is multiplied by operator * first.
+     *
+     * @param _infP The integer to be multiplied
+     * @param _m The small factor
+     * @return infAccumulator& The accumulator itself
+     */
+    infAccumulator &add_product(const infPrecision &_infP, int64_t _m)
+    {
+        uint64_t m = _m < 0 ? -(uint64_t)_m : _m;
+        if (m >= infPrecision_detail::LIMB_BASE)
+        {
+            return *this += _infP * infPrecision(_m);
+        }
+        if (m == 0)
+        {
+            return *this;
+        }
+        reserve_headroom((infPrecision_detail::LIMB_BASE - 1) * m);
+        bool negative_term = _infP.is_negative() != (_m < 0);
+        add_to_sum(negative_term ? negative : positive, infPrecision_detail::to_limbs(_infP), m);
+        return *this;
+    }
+
+    /**
+     * @brief Resolve the pending carries. The value does not change, but
+     * every limb is below 10^9 afterwards, so the full headroom is available
+     * again. It is called automatically when the headroom runs out.
+     *
+     */
+    void normalize()
+    {
+        carry_sum(positive);
+        carry_sum(negative);
+        bound = infPrecision_detail::LIMB_BASE - 1;
+    }
+
+    /**
+     * @brief Reset the accumulator to integer 0, keeping its memory
+     *
+     */
+    void clear()
+    {
+        positive.assign(positive.size(), 0);
+        negative.assign(negative.size(), 0);
+        bound = 0;
+    }
+
+    /**
+     * @brief Get the accumulated sum as a infPrecision object. The carries
+     * are resolved on copies, so the accumulator keeps its state.
+     *
+     * @return infPrecision The sum of all terms
+     */
+    infPrecision value() const
+    {
+        vector<uint32_t> pos = sum_to_limbs(positive);
+        vector<uint32_t> neg = sum_to_limbs(negative);
+        if (infPrecision_detail::compare_limbs(pos, neg) >= 0)
+        {
+            return infPrecision_detail::from_limbs(infPrecision_detail::sub_limbs(pos, neg), false);
+        }
+        return infPrecision_detail::from_limbs(infPrecision_detail::sub_limbs(neg, pos), true);
+    }
+};
+
+#endif
@@ -0,0 +1,399 @@
+/**
+ * @file infAsync.hpp
+ * @brief Run long multiplications, divisions and powers of infinite
+ * precision integers on a thread pool, with futures, progress reports and
+ * cancellation. The synchronous operators of infPrecision.hpp are not
+ * changed.
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2022
+ *
+ */
+
+#ifndef INFASYNC_HPP
+#define INFASYNC_HPP
+
+#include "infPrecision.hpp"
+#include "infReduce.hpp"
+#include <atomic>
+#include <cmath>
+#include <functional>
+#include <future>
+#include <memory>
+
+/**
+ * @brief Construct a cancellation token. Copies of a token share their
+ * state, so the caller keeps one copy and passes another to the operation.
+ *
+ */
+class infCancelToken
+{
+private:
+    shared_ptr<atomic<bool>> flag;
+
+public:
+    /**
+     * @brief Construct a new infCancelToken object, not cancelled
+     *
+     */
+    infCancelToken() : flag(make_shared<atomic<bool>>(false)) {}
+
+    /**
+     * @brief Ask every operation holding the token to stop at its next
+     * checkpoint
+     *
+     */
+    void cancel() const
+    {
+        flag->store(true);
+    }
+
+    /**
+     * @brief Test if the token has been cancelled
+     *
+     */
+    bool is_cancelled() const
+    {
+        return flag->load(memory_order_relaxed);
+    }
+
+    /**
+     * @brief Exception occurs when an operation stops because its token has
+     * been cancelled; the future of the operation holds it
+     *
+     */
+    class cancelled : public invalid_argument
+    {
+    public:
+        cancelled() : invalid_argument("The operation has been cancelled!"){};
+    };
+};
+
+/**
+ * @brief Settings of an asynchronous operation
+ *
+ */
+struct infAsyncOptions
+{
+    infCancelToken token;            // cancels the operation
+    function<void(double)> progress; // called with the done fraction, from the worker
+    infExecutor *executor = nullptr; // executor of the operation, nullptr for the shared one
+};
+
+namespace infPrecision_detail
+{
+    // Estimated work done between two checkpoints, about 10 ms
+    const double ASYNC_GRAIN = 1 << 24;
+
+    /**
+     * @brief Estimate the work of mul_limbs on n and m limbs, n >= m. Both
+     * the Karatsuba steps and the cutting of unbalanced operands keep
+     * n * m^(log2(3) - 1) constant, so the estimates of the parts of a
+     * product add up to the estimate of the product.
+     *
+     */
+    inline double mul_work(double _n, double _m)
+    {
+        return _n * pow(_m, 0.585);
+    }
+
+    /**
+     * @brief State of one asynchronous operation, shared by its checkpoints
+     *
+     */
+    struct async_context
+    {
+        const infAsyncOptions &options;
+        double total; // estimated work of the operation
+        double done = 0;
+
+        async_context(const infAsyncOptions &_options, double _total) : options(_options), total(_total) {}
+
+        /**
+         * @brief Throw if the operation has been cancelled
+         *
+         */
+        void check() const
+        {
+            if (options.token.is_cancelled())
+            {
+                throw infCancelToken::cancelled();
+            }
+        }
+
+        /**
+         * @brief Record finished work and report the progress
+         *
+         */
+        void advance(double _work)
+        {
+            done += _work;
+            if (options.progress)
+            {
+                options.progress(total > 0 ? min(done / total, 1.0) : 1.0);
+            }
+        }
+    };
+
+    /**
+     * @brief Add a magnitude times B^_offset into an accumulator, which is
+     * long enough for the sum
+     *
+     */
+    inline void add_limbs_at(vector<uint32_t> &_acc, const vector<uint32_t> &_part, uint64_t _offset)
+    {
+        uint64_t carry = 0;
+        for (uint64_t i = 0; _offset + i < _acc.size(); i++)
+        {
+            if (i >= _part.size() && carry == 0)
+            {
+                break;
+            }
+            uint64_t cur = _acc[_offset + i] + carry + (i < _part.size() ? _part[i] : 0);
+            carry = cur >= LIMB_BASE;
+            _acc[_offset + i] = cur - carry * LIMB_BASE;
+        }
+    }
+
+    /**
+     * @brief Multiply two magnitudes by mul_limbs at once, between two
+     * checkpoints
+     *
+     */
+    vector<uint32_t> mul_limbs_leaf(const vector<uint32_t> &_a, const vector<uint32_t> &_b, async_context &_context)
+    {
+        _context.check();
+        vector<uint32_t> product = mul_limbs(_a, _b);
+        _context.advance(mul_work(max(_a.size(), _b.size()), min(_a.size(), _b.size())));
+        return product;
+    }
+
+    /**
+     * @brief Multiply two magnitudes like mul_limbs, with a checkpoint about
+     * every ASYNC_GRAIN of work. The upper levels of the recursion are done
+     * here, the same Karatsuba steps and pieces as in mul_limbs, and every
+     * part small enough is multiplied by mul_limbs at once, so the
+     * checkpoints cost no extra multiplication.
+     *
+     */
+    vector<uint32_t> mul_limbs_async(const vector<uint32_t> &_a, const vector<uint32_t> &_b, async_context &_context)
+    {
+        const vector<uint32_t> &longer = _a.size() >= _b.size() ? _a : _b;
+        const vector<uint32_t> &shorter = _a.size() >= _b.size() ? _b : _a;
+        uint64_t n = longer.size(), m = shorter.size();
+        if (mul_work(n, m) <= ASYNC_GRAIN)
+        {
+            return mul_limbs_leaf(longer, shorter, _context);
+        }
+
+        vector<uint32_t> product(n + m, 0);
+        if (2 * m <= n)
+        {
+            // Pieces as long as the shorter operand, or longer so every piece
+            // is about one grain of work
+            uint64_t step = max<uint64_t>(m, (uint64_t)(ASYNC_GRAIN / pow(m, 0.585)));
+            for (uint64_t lo = 0; lo < n; lo += step)
+            {
+                vector<uint32_t> piece(longer.begin() + lo, longer.begin() + min(n, lo + step));
+                trim_limbs(piece);
+                add_limbs_at(product, step > m ? mul_limbs_leaf(piece, shorter, _context) : mul_limbs_async(piece, shorter, _context), lo);
+            }
+            trim_limbs(product);
+            return product;
+        }
+
+        uint64_t h = n / 2;
+        vector<uint32_t> a0(longer.begin(), longer.begin() + h), a1(longer.begin() + h, longer.end());
+        vector<uint32_t> b0(shorter.begin(), shorter.begin() + min(h, m)), b1;
+        if (m > h)
+        {
+            b1.assign(shorter.begin() + h, shorter.end());
+        }
+        trim_limbs(a0);
+        trim_limbs(a1);
+        trim_limbs(b0);
+        trim_limbs(b1);
+        vector<uint32_t> z0 = mul_limbs_async(a0, b0, _context);
+        vector<uint32_t> z2 = mul_limbs_async(a1, b1, _context);
+        vector<uint32_t> z1 = sub_limbs(sub_limbs(mul_limbs_async(add_limbs(a0, a1), add_limbs(b0, b1), _context), z0), z2);
+        add_limbs_at(product, z0, 0);
+        add_limbs_at(product, z1, h);
+        add_limbs_at(product, z2, 2 * h);
+        trim_limbs(product);
+        return product;
+    }
+
+    /**
+     * @brief Divide two magnitudes like divmod_limbs, with a checkpoint
+     * about every ASYNC_GRAIN of work. The quotient is found a block of
+     * limbs at a time from the top: the remainder so far and the next limbs
+     * of the dividend are divided by divmod_limbs, and the remainder is
+     * carried to the next block. A block has at least 16 limbs, so the
+     * scaling done by divmod_limbs stays small against the division.
+     *
+     */
+    void divmod_limbs_async(const vector<uint32_t> &_u, const vector<uint32_t> &_v,
+                            vector<uint32_t> &_q, vector<uint32_t> &_r, async_context &_context)
+    {
+        _context.check();
+        if (compare_limbs(_u, _v) < 0)
+        {
+            _q = {0};
+            _r = _u;
+            return;
+        }
+        uint64_t n = _v.size();
+        uint64_t block = max<uint64_t>(16, (uint64_t)(ASYNC_GRAIN / n));
+        _q.assign(_u.size() - n + 1, 0);
+
+        // The top n - 1 limbs are smaller than the divisor
+        _r.assign(_u.begin() + (_u.size() - n + 1), _u.end());
+        trim_limbs(_r);
+        for (uint64_t hi = _q.size(); hi > 0;)
+        {
+            _context.check();
+            uint64_t lo = hi > block ? hi - block : 0;
+            vector<uint32_t> window(_u.begin() + lo, _u.begin() + hi);
+            window.insert(window.end(), _r.begin(), _r.end());
+            trim_limbs(window);
+            vector<uint32_t> q;
+            divmod_limbs(window, _v, q, _r);
+            copy(q.begin(), q.end(), _q.begin() + lo);
+            _context.advance((double)(hi - lo) * n);
+            hi = lo;
+        }
+        trim_limbs(_q);
+    }
+
+    /**
+     * @brief Run an operation on an executor and return its future. An
+     * exception of the operation, including a cancellation, is stored in
+     * the future.
+     *
+     */
+    template <class Result, class Operation>
+    future<Result> submit_async(const infAsyncOptions &_options, Operation _operation)
+    {
+        shared_ptr<promise<Result>> result = make_shared<promise<Result>>();
+        future<Result> f = result->get_future();
+        infExecutor &executor = _options.executor ? *_options.executor : infExecutor::shared();
+        executor.post([result, _options, _operation]()
+                      {
+                          try
+                          {
+                              async_context context(_options, 0);
+                              context.check();
+                              Result value = _operation(context);
+                              // The work is only estimated, so the end is reported exactly
+                              if (_options.progress)
+                              {
+                                  _options.progress(1.0);
+                              }
+                              result->set_value(std::move(value));
+                          }
+                          catch (...)
+                          {
+                              result->set_exception(current_exception());
+                          } });
+        return f;
+    }
+}
+
+/**
+ * @brief Multiply two integers on an executor
+ *
+ * @param _infP1 The first integer
+ * @param _infP2 The second integer
+ * @param _options The token, the progress callback and the executor
+ * @return future<infPrecision> The product
+ */
+future<infPrecision> async_mul(infPrecision _infP1, infPrecision _infP2,
+                               const infAsyncOptions &_options = infAsyncOptions())
+{
+    using namespace infPrecision_detail;
+    return submit_async<infPrecision>(_options, [_infP1, _infP2](async_context &_context)
+                                      {
+                                          vector<uint32_t> a = to_limbs(_infP1), b = to_limbs(_infP2);
+                                          _context.total = mul_work(max(a.size(), b.size()), min(a.size(), b.size()));
+                                          bool negative = _infP1.is_negative() != _infP2.is_negative();
+                                          return from_limbs(mul_limbs_async(a, b, _context), negative); });
+}
+
+/**
+ * @brief Divide two integers on an executor, with the same quotient and
+ * remainder as divmod()
+ *
+ * @param _infP1 The dividend
+ * @param _infP2 The divisor, the future holds cannot_divideZero if it is 0
+ * @param _options The token, the progress callback and the executor
+ * @return future<pair<infPrecision, infPrecision>> The quotient and the
+ * remainder
+ */
+future<pair<infPrecision, infPrecision>> async_divmod(infPrecision _infP1, infPrecision _infP2,
+                                                      const infAsyncOptions &_options = infAsyncOptions())
+{
+    using namespace infPrecision_detail;
+    return submit_async<pair<infPrecision, infPrecision>>(_options, [_infP1, _infP2](async_context &_context)
+                                                          {
+                                                              vector<uint32_t> u = to_limbs(_infP1), v = to_limbs(_infP2);
+                                                              if (is_zero_limbs(v))
+                                                              {
+                                                                  throw infPrecision::cannot_divideZero();
+                                                              }
+                                                              _context.total = u.size() >= v.size() ? (double)(u.size() - v.size() + 1) * v.size() : 0;
+                                                              vector<uint32_t> q, r;
+                                                              divmod_limbs_async(u, v, q, r, _context);
+                                                              bool neg_quotient = _infP1.is_negative() != _infP2.is_negative();
+                                                              return make_pair(from_limbs(q, neg_quotient), from_limbs(r, _infP1.is_negative())); });
+}
+
+/**
+ * @brief Calculate _base ^ _exp on an executor, by squaring from the most
+ * significant bit of the exponent
+ *
+ * @param _base The base
+ * @param _exp The exponent, 0^0 is 1
+ * @param _options The token, the progress callback and the executor
+ * @return future<infPrecision> The power
+ */
+future<infPrecision> async_pow(infPrecision _base, uint64_t _exp,
+                               const infAsyncOptions &_options = infAsyncOptions())
+{
+    using namespace infPrecision_detail;
+    return submit_async<infPrecision>(_options, [_base, _exp](async_context &_context)
+                                      {
+                                          vector<uint32_t> base = to_limbs(_base), result = {1};
+                                          int top = 63;
+                                          while (top >= 0 && (_exp >> top) == 0)
+                                          {
+                                              top--;
+                                          }
+                                          // The power of the bits so far has about
+                                          // prefix * |base| limbs
+                                          double size = base.size();
+                                          for (int bit = top - 1; bit >= 0; bit--)
+                                          {
+                                              double prefix = (double)(_exp >> (bit + 1));
+                                              _context.total += mul_work(prefix * size, prefix * size);
+                                              if ((_exp >> bit) & 1)
+                                              {
+                                                  _context.total += mul_work(2 * prefix * size, size);
+                                              }
+                                          }
+                                          for (int bit = top; bit >= 0; bit--)
+                                          {
+                                              if (bit != top)
+                                              {
+                                                  result = mul_limbs_async(result, result, _context);
+                                              }
+                                              if ((_exp >> bit) & 1)
+                                              {
+                                                  result = bit == top ? base : mul_limbs_async(result, base, _context);
+                                              }
+                                          }
+                                          bool negative = _base.is_negative() && (_exp & 1);
+                                          return from_limbs(result, negative); });
+}
+
+#endif
@@ -0,0 +1,335 @@
+/**
+ * @file infColumn.hpp
+ * @brief Construct a columnar store of many infinite precision integers in
+ * one shared digit arena, parsed from and formatted to whole buffers of
+ * delimiter-separated numbers at once.
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2022
+ *
+ */
+
+#ifndef INFCOLUMN_HPP
+#define INFCOLUMN_HPP
+
+#include "infPrecision.hpp"
+#include <cstring>
+
+namespace infPrecision_detail
+{
+    const uint64_t COLUMN_CHUNK = 65536; // characters unpacked at once, so they stay in the cache
+
+    /**
+     * @brief Get the position of the lowest set bit, _mask must not be 0
+     *
+     */
+    inline uint64_t lowest_bit(uint64_t _mask)
+    {
+#ifdef __GNUC__
+        return __builtin_ctzll(_mask);
+#else
+        uint64_t pos = 0;
+        for (; (_mask & 1) == 0; _mask >>= 1)
+        {
+            pos++;
+        }
+        return pos;
+#endif
+    }
+
+    /**
+     * @brief Unpack characters into digits and mark the ones which are not
+     * digits, eight characters at a time in a 64-bit word (SIMD within a
+     * register). Every character is converted by xor with '0', whatever it
+     * is, and every block of 64 characters gets a mask of its non-digit
+     * characters, so there is no branch per character.
+     *
+     * @param _chars The characters
+     * @param _n Number of characters
+     * @param _out The digits, one for every character
+     * @param _masks One mask for every 64 characters, bit j is set if
+     * character j of the block is not a digit
+     */
+    void unpack_digits(const char *_chars, uint64_t _n, int8_t *_out, uint64_t *_masks)
+    {
+        const uint64_t ONES = 0x0101010101010101; // 1 in every byte
+        uint64_t lo = 0;
+#if !defined(__BYTE_ORDER__) || __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+        for (; lo + 64 <= _n; lo += 64)
+        {
+            uint64_t mask = 0;
+            for (uint64_t k = 0; k < 8; k++)
+            {
+                uint64_t word;
+                memcpy(&word, _chars + lo + 8 * k, 8);
+                word ^= ONES * '0';
+                memcpy(_out + lo + 8 * k, &word, 8);
+                // The high bit of a byte is set if the byte is 10 or more,
+                // without any carry between the bytes
+                uint64_t high = (((word & ONES * 0x7F) + ONES * 0x76) | word) & ONES * 0x80;
+                // Gather the eight high bits into the top byte
+                mask |= (((high >> 7) * 0x0102040810204080) >> 56) << (8 * k);
+            }
+            _masks[lo / 64] = mask;
+        }
+#endif
+        for (; lo < _n; lo += 64)
+        {
+            uint64_t mask = 0;
+            for (uint64_t j = 0; j < 64 && lo + j < _n; j++)
+            {
+                _out[lo + j] = _chars[lo + j] ^ '0';
+                mask |= (uint64_t)((unsigned char)(_chars[lo + j] ^ '0') > 9) << j;
+            }
+            _masks[lo / 64] = mask;
+        }
+    }
+}
+
+/**
+ * @brief Construct the class of a column of integers. The digits of all
+ * integers are packed into one arena of bytes, otherwise in the same form
+ * as in infPrecision: one digit per element, most significant first, with
+ * the sign on the first digit. Every integer is preceded by one unused
+ * slot, so a parsed buffer is unpacked character by character into the
+ * arena and its delimiters become the slots, and only one bound per integer
+ * is kept. A parsed '-' also stays in the arena as a marker before the
+ * digits. Parsing and formatting a column allocate once for the whole
+ * buffer, instead of once or twice for every integer, and an infPrecision
+ * object is only built when an integer is read.
+ *
+ */
+class infColumn
+{
+private:
+    static const int8_t MINUS = '-' ^ '0'; // marker of a parsed '-'
+
+    vector<int8_t> arena = vector<int8_t>(1); // slot and digits of all integers
+    vector<uint64_t> bounds = {0};            // integer i is between the slots bounds[i] and bounds[i + 1]
+
+    /**
+     * @brief Get the position of the first digit of an integer in the arena
+     *
+     */
+    uint64_t first_digit(uint64_t _i) const
+    {
+        uint64_t first = bounds[_i] + 1;
+        return first + (first < bounds[_i + 1] && arena[first] == MINUS);
+    }
+
+    /**
+     * @brief Check the parsed integer which ends before the slot _end, then
+     * add it to the column
+     *
+     */
+    void close(uint64_t _end)
+    {
+        bounds.push_back(_end);
+        uint64_t first = first_digit(size() - 1);
+        // An integer needs a digit, and only 0 itself may start with 0
+        if (first == _end || (arena[first] == 0 && _end - first > 1))
+        {
+            throw bad_field(size() - 1);
+        }
+        if (arena[first - 1] == MINUS)
+        {
+            arena[first] *= (-1);
+        }
+    }
+
+public:
+    /**
+     * @brief Construct a default infColumn object without any integer
+     *
+     */
+    infColumn() {}
+
+    /**
+     * @brief Construct a new infColumn object by a range of infPrecision
+     * objects
+     *
+     * @param _first The first integer
+     * @param _last One past the last integer
+     */
+    template <class Iterator>
+    infColumn(Iterator _first, Iterator _last)
+    {
+        for (; _first != _last; ++_first)
+        {
+            push_back(*_first);
+        }
+    }
+
+    /**
+     * @brief Parse a buffer of integers separated by _delimiter, such as
+     * one column of a CSV file or one integer per line. A delimiter after
+     * the last integer is allowed. Every integer is checked the same way as
+     * by the string constructor of infPrecision.
+     *
+     * @param _first The first character of the buffer
+     * @param _last One past the last character
+     * @param _delimiter The delimiter, which must not be a digit or '-'
+     * @return infColumn The column of the integers
+     */
+    static infColumn parse(const char *_first, const char *_last, char _delimiter = '\n')
+    {
+        using namespace infPrecision_detail;
+        uint64_t length = _last - _first;
+        infColumn column;
+        // Character j of the buffer is at j + 1 of the arena, after the slot
+        // of the first integer
+        column.arena.resize(length + 2);
+        column.bounds.reserve(count(_first, _last, _delimiter) + 2);
+        vector<uint64_t> masks((min(length, COLUMN_CHUNK) + 63) / 64);
+
+        // Only the characters which are not digits are visited one by one
+        for (uint64_t lo = 0; lo < length; lo += COLUMN_CHUNK)
+        {
+            uint64_t w = min(COLUMN_CHUNK, length - lo);
+            unpack_digits(_first + lo, w, column.arena.data() + 1 + lo, masks.data());
+            for (uint64_t b = 0; b * 64 < w; b++)
+            {
+                for (uint64_t mask = masks[b]; mask != 0; mask &= mask - 1)
+                {
+                    uint64_t pos = lo + b * 64 + lowest_bit(mask) + 1;
+                    if (column.arena[pos] == MINUS && pos == column.bounds.back() + 1)
+                    {
+                        continue;
+                    }
+                    if (_first[pos - 1] != _delimiter)
+                    {
+                        throw bad_field(column.size());
+                    }
+                    column.close(pos);
+                }
+            }
+        }
+        if (column.bounds.back() < length)
+        {
+            column.close(length + 1);
+        }
+        else
+        {
+            column.arena.pop_back(); // the buffer ends with a delimiter
+        }
+        return column;
+    }
+
+    /**
+     * @brief Parse a buffer of integers separated by _delimiter, see
+     * parse(const char *, const char *, char)
+     *
+     */
+    static infColumn parse(const string &_buffer, char _delimiter = '\n')
+    {
+        return parse(_buffer.data(), _buffer.data() + _buffer.size(), _delimiter);
+    }
+
+    /**
+     * @brief Format all integers into one buffer, each one followed by
+     * _delimiter. The buffer is sized once and filled in one pass.
+     *
+     * @param _delimiter The delimiter
+     * @return string The buffer
+     */
+    string format(char _delimiter = '\n') const
+    {
+        uint64_t total = 0;
+        for (uint64_t i = 0; i < size(); i++)
+        {
+            total += bounds[i + 1] - first_digit(i) + (arena[first_digit(i)] < 0) + 1;
+        }
+        string out(total, _delimiter);
+        char *pos = &out[0];
+        for (uint64_t i = 0; i < size(); i++)
+        {
+            const int8_t *digits = arena.data() + first_digit(i);
+            uint64_t n = num_digits(i);
+            if (digits[0] < 0)
+            {
+                *pos++ = '-';
+            }
+            *pos = '0' + infPrecision_detail::abs_digit(digits[0]);
+            for (uint64_t j = 1; j < n; j++)
+            {
+                pos[j] = '0' + digits[j];
+            }
+            pos += n + 1; // the delimiter is already there
+        }
+        return out;
+    }
+
+    /**
+     * @brief Append an integer to the column
+     *
+     * @param _infP A infPrecision object
+     */
+    void push_back(const infPrecision &_infP)
+    {
+        const vector<int64_t> &digits = _infP.digits();
+        arena.insert(arena.end(), digits.begin(), digits.end());
+        bounds.push_back(arena.size());
+        arena.push_back(0);
+    }
+
+    /**
+     * @brief Get the number of integers in the column
+     *
+     */
+    uint64_t size() const
+    {
+        return bounds.size() - 1;
+    }
+
+    /**
+     * @brief Get the number of decimal digits of an integer, without
+     * building it
+     *
+     * @param _i Index of the integer
+     */
+    uint64_t num_digits(uint64_t _i) const
+    {
+        return bounds[_i + 1] - first_digit(_i);
+    }
+
+    /**
+     * @brief Get a read-only pointer to the digits of an integer in the
+     * arena, in the same form as infPrecision::digits() with one byte per
+     * digit
+     *
+     * @param _i Index of the integer
+     */
+    const int8_t *digits(uint64_t _i) const
+    {
+        return arena.data() + first_digit(_i);
+    }
+
+    /**
+     * @brief Build one integer of the column as a infPrecision object
+     *
+     * @param _i Index of the integer
+     * @return infPrecision A copy of the integer
+     */
+    infPrecision operator[](uint64_t _i) const
+    {
+        return infPrecision(infPrecision_detail::trusted,
+                            vector<int64_t>(arena.begin() + first_digit(_i), arena.begin() + bounds[_i + 1]));
+    }
+
+    /**
+     * @brief Exception occurs when a field of a parsed buffer is not a
+     * valid integer
+     *
+     */
+    class bad_field : public invalid_argument
+    {
+    public:
+        uint64_t field; // index of the field, from 0
+
+        bad_field(uint64_t _field)
+            : invalid_argument("Field " + std::to_string(_field) + " is not a valid integer!"), field(_field){};
+    };
+};
+
+#endif
@@ -0,0 +1,135 @@
+/**
+ * @file infCombinatorics.hpp
+ * @brief Factorial, binomial coefficient and primorial of infinite precision,
+ * evaluated by balanced product trees over prime factorizations.
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2022
+ *
+ */
+
+#ifndef INFCOMBINATORICS_HPP
+#define INFCOMBINATORICS_HPP
+
+#include "infPrecision.hpp"
+#include "infPrime.hpp"
+
+// Forward declaration
+infPrecision factorial(uint32_t _n);
+infPrecision binomial(uint32_t _n, uint32_t _k);
+infPrecision primorial(uint32_t _n);
+
+namespace infPrecision_detail
+{
+    /**
+     * @brief Calculate the prime swing n! / (floor(n/2)!)^2. The exponent of
+     * every prime p in it is the number of odd terms in floor(n/p),
+     * floor(n/p^2), ...
+     *
+     * @param _n The argument of the swing
+     * @param _primes All primes not greater than _n, possibly more
+     * @return vector<uint32_t> The prime swing in limbs
+     */
+    vector<uint32_t> prime_swing_limbs(uint32_t _n, const vector<uint32_t> &_primes)
+    {
+        vector<uint64_t> factors;
+        for (uint32_t p : _primes)
+        {
+            if (p > _n)
+            {
+                break;
+            }
+            for (uint64_t q = _n / p; q > 0; q /= p)
+            {
+                if (q % 2 == 1)
+                {
+                    factors.push_back(p);
+                }
+            }
+        }
+        return product_of_small(factors);
+    }
+
+    /**
+     * @brief Calculate n! recursively by n! = (floor(n/2)!)^2 * swing(n)
+     *
+     * @param _n The argument of the factorial
+     * @param _primes All primes not greater than _n
+     * @return vector<uint32_t> The factorial in limbs
+     */
+    vector<uint32_t> factorial_limbs(uint32_t _n, const vector<uint32_t> &_primes)
+    {
+        if (_n < 2)
+        {
+            return {1};
+        }
+        vector<uint32_t> half = factorial_limbs(_n / 2, _primes);
+        return mul_limbs(mul_limbs(half, half), prime_swing_limbs(_n, _primes));
+    }
+}
+
+/**
+ * @brief Calculate the factorial n! by the prime swing algorithm. Every
+ * swing is the product of its prime factors by a balanced product tree,
+ * so the large multiplications always have operands of similar size.
+ *
+ * @param _n The argument of the factorial
+ * @return infPrecision The factorial of _n
+ */
+infPrecision factorial(uint32_t _n)
+{
+    vector<uint32_t> primes = infPrecision_detail::primes_up_to(_n);
+    return infPrecision_detail::from_limbs(infPrecision_detail::factorial_limbs(_n, primes), false);
+}
+
+/**
+ * @brief Calculate the binomial coefficient C(n, k). The exponent of every
+ * prime p is counted by Legendre's formula, and the prime powers are
+ * multiplied by a balanced product tree.
+ *
+ * @param _n The number of items
+ * @param _k The number of chosen items
+ * @return infPrecision The binomial coefficient, 0 if _k > _n
+ */
+infPrecision binomial(uint32_t _n, uint32_t _k)
+{
+    if (_k > _n)
+    {
+        return infPrecision();
+    }
+    vector<uint64_t> factors;
+    for (uint32_t p : infPrecision_detail::primes_up_to(_n))
+    {
+        // exponent of p = sum of floor(n/p^i) - floor(k/p^i) - floor((n-k)/p^i)
+        for (uint64_t pk = p; pk <= _n; pk *= p)
+        {
+            uint64_t e = _n / pk - _k / pk - (_n - _k) / pk;
+            if (e == 1)
+            {
+                factors.push_back(p);
+            }
+            if (pk > _n / p)
+            {
+                break;
+            }
+        }
+    }
+    return infPrecision_detail::from_limbs(infPrecision_detail::product_of_small(factors), false);
+}
+
+/**
+ * @brief Calculate the primorial n#, the product of all primes not greater
+ * than n, by a balanced product tree
+ *
+ * @param _n The upper bound of the primes
+ * @return infPrecision The primorial of _n
+ */
+infPrecision primorial(uint32_t _n)
+{
+    vector<uint32_t> primes = infPrecision_detail::primes_up_to(_n);
+    vector<uint64_t> factors(primes.begin(), primes.end());
+    return infPrecision_detail::from_limbs(infPrecision_detail::product_of_small(factors), false);
+}
+
+#endif
@@ -0,0 +1,635 @@
+/**
+ * @file infDecimal.hpp
+ * @brief Construct a class of exact decimal fixed-point numbers: an
+ * infPrecision mantissa with a number of digits after the decimal point,
+ * for money and other values which must not pick up binary rounding errors.
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2022
+ *
+ */
+
+#ifndef INFDECIMAL_HPP
+#define INFDECIMAL_HPP
+
+#include "infPrecision.hpp"
+
+/**
+ * @brief Rounding modes of infDecimal, the same as the ones of
+ * java.math.RoundingMode and Python's decimal module
+ *
+ */
+enum infRounding
+{
+    ROUND_DOWN,      // toward 0
+    ROUND_UP,        // away from 0
+    ROUND_FLOOR,     // toward negative infinity
+    ROUND_CEILING,   // toward positive infinity
+    ROUND_HALF_UP,   // to the nearest, ties away from 0
+    ROUND_HALF_DOWN, // to the nearest, ties toward 0
+    ROUND_HALF_EVEN  // to the nearest, ties to the even neighbour
+};
+
+namespace infPrecision_detail
+{
+    /**
+     * @brief Decide if a quotient truncated toward 0 has to move one unit
+     * away from 0 to be rounded by _mode
+     *
+     * @param _mode The rounding mode
+     * @param _negative True if the exact value is negative
+     * @param _inexact True if the dropped part is not 0
+     * @param _half -1, 0 or 1 if the dropped part is smaller than, equal to
+     * or greater than half a unit
+     * @param _odd True if the truncated quotient is odd
+     */
+    inline bool round_away(infRounding _mode, bool _negative, bool _inexact, int _half, bool _odd)
+    {
+        if (!_inexact)
+        {
+            return false;
+        }
+        switch (_mode)
+        {
+        case ROUND_DOWN:
+            return false;
+        case ROUND_UP:
+            return true;
+        case ROUND_FLOOR:
+            return _negative;
+        case ROUND_CEILING:
+            return !_negative;
+        case ROUND_HALF_UP:
+            return _half >= 0;
+        case ROUND_HALF_DOWN:
+            return _half > 0;
+        default:
+            return _half > 0 || (_half == 0 && _odd);
+        }
+    }
+}
+
+/**
+ * @brief Construct the class of decimal fixed-point numbers. A number is
+ * stored as mantissa / 10^scale, so "-123.4500" has the mantissa -1234500
+ * and the scale 4; the trailing zeros are kept, like in a ledger. Addition,
+ * subtraction and multiplication are exact: the scale of a sum is the
+ * larger scale of the operands, the scale of a product is the sum of the
+ * scales. Division and rescale() round by an infRounding mode. Rescaling
+ * only appends or cuts digits of the mantissa, so it costs no
+ * multiplication or division.
+ *
+ */
+class infDecimal
+{
+private:
+    infPrecision mantissa;
+    uint64_t scale = 0;
+
+    /**
+     * @brief Build a mantissa from its digits, which may have leading zeros
+     *
+     */
+    static infPrecision make_mantissa(vector<int64_t> &&_digits, bool _negative)
+    {
+        uint64_t first = 0;
+        while (first + 1 < _digits.size() && _digits[first] == 0)
+        {
+            first++;
+        }
+        _digits.erase(_digits.begin(), _digits.begin() + first);
+        if (_negative && _digits[0] != 0)
+        {
+            _digits[0] *= (-1);
+        }
+        return infPrecision(infPrecision_detail::trusted, std::move(_digits));
+    }
+
+    friend istream &operator>>(istream &in, infDecimal &_infD);
+
+public:
+    /**
+     * @brief Construct a default infDecimal object with 0 and scale 0
+     *
+     */
+    infDecimal() {}
+
+    /**
+     * @brief Construct a new infDecimal object by 64bit fixed-width signed
+     * integer, with scale 0
+     *
+     * @param _64bit A 64bit fixed-width signed integer
+     */
+    infDecimal(int64_t _64bit) : mantissa(_64bit) {}
+
+    /**
+     * @brief Construct a new infDecimal object with the value
+     * _mantissa / 10^_scale
+     *
+     * @param _mantissa The digits of the number as an integer
+     * @param _scale The number of digits after the decimal point
+     */
+    explicit infDecimal(const infPrecision &_mantissa, uint64_t _scale = 0)
+        : mantissa(_mantissa), scale(_scale)
+    {
+    }
+
+    /**
+     * @brief Construct a new infDecimal object by a decimal string such as
+     * "-123.4500", in one pass over the characters. The scale is the number
+     * of digits after the point. The integer part must have at least one
+     * digit and no leading zeros, and a point must be followed by a digit.
+     *
+     * @param _str A decimal string
+     */
+    infDecimal(const string &_str)
+    {
+        bool negative = !_str.empty() && _str[0] == '-';
+        bool point = false;
+        uint64_t integral = 0; // digits before the point
+        vector<int64_t> digits;
+        digits.reserve(_str.size());
+        for (uint64_t i = negative; i < _str.size(); i++)
+        {
+            char c = _str[i];
+            if (infPrecision_detail::is_digit_char(c))
+            {
+                digits.push_back(c - '0');
+            }
+            else if (c == '.' && !point)
+            {
+                point = true;
+                integral = digits.size();
+            }
+            else
+            {
+                throw infPrecision::not_numerical();
+            }
+        }
+        if (!point)
+        {
+            integral = digits.size();
+        }
+        if (integral == 0 || (point && digits.size() == integral))
+        {
+            throw infPrecision::not_numerical();
+        }
+        // If the integer part is not 0 and has leading 0s, throw exception
+        if (digits[0] == 0 && integral > 1)
+        {
+            throw infPrecision::cannot_leadZero();
+        }
+        scale = digits.size() - integral;
+        mantissa = make_mantissa(std::move(digits), negative);
+    }
+
+    /**
+     * @brief Get the mantissa, the number times 10^scale
+     *
+     */
+    const infPrecision &get_mantissa() const
+    {
+        return mantissa;
+    }
+
+    /**
+     * @brief Get the number of digits after the decimal point
+     *
+     */
+    uint64_t get_scale() const
+    {
+        return scale;
+    }
+
+    /**
+     * @brief Test if the number is negative
+     *
+     */
+    bool is_negative() const
+    {
+        return mantissa.is_negative();
+    }
+
+    /**
+     * @brief Change the number of digits after the decimal point. A larger
+     * scale appends zeros and is exact; a smaller scale cuts the last digits
+     * of the mantissa and rounds by _mode, which only reads the cut digits.
+     *
+     * @param _scale The new scale
+     * @param _mode The rounding mode used when digits are cut
+     * @return infDecimal& The number after rescaling
+     */
+    infDecimal &rescale(uint64_t _scale, infRounding _mode = ROUND_HALF_EVEN)
+    {
+        if (_scale >= scale)
+        {
+            mantissa.mul_pow10(_scale - scale);
+            scale = _scale;
+            return *this;
+        }
+        uint64_t cut = scale - _scale;
+        const vector<int64_t> &digits = mantissa.digits();
+        uint64_t size = digits.size();
+
+        // Compare the cut digits with half a unit by the first cut digit and
+        // the ones after it; fewer digits than cut are below half
+        bool inexact = digits[0] != 0;
+        int half = -1;
+        if (cut <= size)
+        {
+            int64_t first = infPrecision_detail::abs_digit(digits[size - cut]);
+            bool rest = false;
+            for (uint64_t i = size - cut + 1; i < size && !rest; i++)
+            {
+                rest = digits[i] != 0;
+            }
+            inexact = first != 0 || rest;
+            half = first < 5 ? -1 : (first > 5 || rest ? 1 : 0);
+        }
+        bool negative = mantissa.is_negative();
+        mantissa.truncate_digits(cut < size ? size - cut : 0);
+        bool odd = infPrecision_detail::abs_digit(mantissa.digits().back()) % 2 == 1;
+        if (infPrecision_detail::round_away(_mode, negative, inexact, half, odd))
+        {
+            if (negative)
+            {
+                --mantissa;
+            }
+            else
+            {
+                ++mantissa;
+            }
+        }
+        scale = _scale;
+        return *this;
+    }
+
+    /**
+     * @brief Round the number to an integer
+     *
+     * @param _mode The rounding mode
+     * @return infPrecision The rounded integer
+     */
+    infPrecision to_infPrecision(infRounding _mode = ROUND_DOWN) const
+    {
+        infDecimal rounded = *this;
+        return rounded.rescale(0, _mode).mantissa;
+    }
+
+    /**
+     * @brief Compare the number with another one by value, so 1.50 equals
+     * 1.5
+     *
+     * @param _infD Another infDecimal object
+     * @return int Return -1, 0 or 1 if the number is smaller than, equal to
+     * or greater than _infD
+     */
+    int compare(const infDecimal &_infD) const
+    {
+        if (is_negative() != _infD.is_negative())
+        {
+            return is_negative() ? -1 : 1;
+        }
+        // Only the mantissa with the smaller scale is copied and extended
+        const infPrecision *left = &mantissa, *right = &_infD.mantissa;
+        infPrecision aligned;
+        if (scale < _infD.scale)
+        {
+            aligned = mantissa;
+            left = &aligned.mul_pow10(_infD.scale - scale);
+        }
+        else if (_infD.scale < scale)
+        {
+            aligned = _infD.mantissa;
+            right = &aligned.mul_pow10(scale - _infD.scale);
+        }
+        if (*left == *right)
+        {
+            return 0;
+        }
+        return *left < *right ? -1 : 1;
+    }
+
+    /**
+     * @brief Overloaded compound assignment += for decimal numbers, the
+     * scale becomes the larger scale
+     *
+     * @param _infD The number to add
+     * @return infDecimal& The sum
+     */
+    infDecimal &operator+=(const infDecimal &_infD)
+    {
+        if (scale < _infD.scale)
+        {
+            rescale(_infD.scale);
+        }
+        if (_infD.scale < scale)
+        {
+            infPrecision aligned = _infD.mantissa;
+            mantissa += aligned.mul_pow10(scale - _infD.scale);
+        }
+        else
+        {
+            mantissa += _infD.mantissa;
+        }
+        return *this;
+    }
+
+    /**
+     * @brief Overloaded compound assignment -= for decimal numbers, the
+     * scale becomes the larger scale
+     *
+     * @param _infD The number to subtract
+     * @return infDecimal& The difference
+     */
+    infDecimal &operator-=(const infDecimal &_infD)
+    {
+        if (scale < _infD.scale)
+        {
+            rescale(_infD.scale);
+        }
+        if (_infD.scale < scale)
+        {
+            infPrecision aligned = _infD.mantissa;
+            mantissa -= aligned.mul_pow10(scale - _infD.scale);
+        }
+        else
+        {
+            mantissa -= _infD.mantissa;
+        }
+        return *this;
+    }
+
+    /**
+     * @brief Overloaded compound assignment *= for decimal numbers, the
+     * scale becomes the sum of the scales
+     *
+     * @param _infD The number to multiply by
+     * @return infDecimal& The product
+     */
+    infDecimal &operator*=(const infDecimal &_infD)
+    {
+        mantissa *= _infD.mantissa;
+        scale += _infD.scale;
+        return *this;
+    }
+
+    /**
+     * @brief Overloaded unary operator - to negate the number
+     *
+     * @return infDecimal The negated number with the same scale
+     */
+    infDecimal operator-() const
+    {
+        return infDecimal(-mantissa, scale);
+    }
+};
+
+/**
+ * @brief Overloaded binary operator + to calculate the exact summation of
+ * two decimal numbers
+ *
+ */
+infDecimal operator+(infDecimal _infD1, const infDecimal &_infD2)
+{
+    return _infD1 += _infD2;
+}
+
+/**
+ * @brief Overloaded binary operator - to calculate the exact subtraction of
+ * two decimal numbers
+ *
+ */
+infDecimal operator-(infDecimal _infD1, const infDecimal &_infD2)
+{
+    return _infD1 -= _infD2;
+}
+
+/**
+ * @brief Overloaded binary operator * to calculate the exact multiplication
+ * of two decimal numbers
+ *
+ */
+infDecimal operator*(infDecimal _infD1, const infDecimal &_infD2)
+{
+    return _infD1 *= _infD2;
+}
+
+/**
+ * @brief Divide two decimal numbers and round the quotient to _scale digits
+ * after the point. The quotient is calculated by one integer division at
+ * the target scale, so no digit beyond it is ever produced.
+ *
+ * @param _dividend The dividend
+ * @param _divisor The divisor, must not be 0
+ * @param _scale The scale of the quotient
+ * @param _mode The rounding mode
+ * @return infDecimal The rounded quotient
+ */
+infDecimal divide(const infDecimal &_dividend, const infDecimal &_divisor, uint64_t _scale,
+                  infRounding _mode = ROUND_HALF_EVEN)
+{
+    using namespace infPrecision_detail;
+    // quotient * 10^-_scale = (m1 * 10^-s1) / (m2 * 10^-s2)
+    infPrecision numerator = _dividend.get_mantissa(), denominator = _divisor.get_mantissa();
+    if (_scale + _divisor.get_scale() >= _dividend.get_scale())
+    {
+        numerator.mul_pow10(_scale + _divisor.get_scale() - _dividend.get_scale());
+    }
+    else
+    {
+        denominator.mul_pow10(_dividend.get_scale() - _scale - _divisor.get_scale());
+    }
+    vector<uint32_t> u = to_limbs(numerator), v = to_limbs(denominator);
+    if (is_zero_limbs(v))
+    {
+        throw infPrecision::cannot_divideZero();
+    }
+    vector<uint32_t> q, r;
+    divmod_limbs(u, v, q, r);
+
+    bool negative = _dividend.is_negative() != _divisor.is_negative();
+    bool inexact = !is_zero_limbs(r);
+    int half = inexact ? compare_limbs(add_limbs(r, r), v) : -1;
+    bool odd = !q.empty() && q[0] % 2 == 1;
+    infPrecision quotient = from_limbs(q, negative);
+    if (round_away(_mode, negative, inexact, half, odd))
+    {
+        if (negative)
+        {
+            --quotient;
+        }
+        else
+        {
+            ++quotient;
+        }
+    }
+    return infDecimal(quotient, _scale);
+}
+
+/**
+ * @brief Overloaded binary operator / to divide two decimal numbers, the
+ * quotient has the larger scale of the operands and is rounded half to
+ * even, see divide()
+ *
+ */
+infDecimal operator/(const infDecimal &_infD1, const infDecimal &_infD2)
+{
+    return divide(_infD1, _infD2, max(_infD1.get_scale(), _infD2.get_scale()));
+}
+
+/**
+ * @brief Overloaded comparison operators of decimal numbers, by value
+ *
+ */
+bool operator==(const infDecimal &_infD1, const infDecimal &_infD2)
+{
+    return _infD1.compare(_infD2) == 0;
+}
+
+bool operator!=(const infDecimal &_infD1, const infDecimal &_infD2)
+{
+    return _infD1.compare(_infD2) != 0;
+}
+
+bool operator<(const infDecimal &_infD1, const infDecimal &_infD2)
+{
+    return _infD1.compare(_infD2) < 0;
+}
+
+bool operator<=(const infDecimal &_infD1, const infDecimal &_infD2)
+{
+    return _infD1.compare(_infD2) <= 0;
+}
+
+bool operator>(const infDecimal &_infD1, const infDecimal &_infD2)
+{
+    return _infD1.compare(_infD2) > 0;
+}
+
+bool operator>=(const infDecimal &_infD1, const infDecimal &_infD2)
+{
+    return _infD1.compare(_infD2) >= 0;
+}
+
+/**
+ * @brief Format a decimal number with all digits of its scale, such as
+ * "-123.4500" or "0.05". The string is sized once and filled in one pass.
+ *
+ * @param _infD A infDecimal object
+ * @return string The decimal string
+ */
+string to_string(const infDecimal &_infD)
+{
+    const vector<int64_t> &digits = _infD.get_mantissa().digits();
+    uint64_t scale = _infD.get_scale();
+    // A number below 1 gets zeros before its digits, "0.05" from 5
+    uint64_t padding = scale >= digits.size() ? scale - digits.size() + 1 : 0;
+    uint64_t size = _infD.is_negative() + padding + digits.size() + (scale > 0);
+    string out(size, '0');
+    uint64_t pos = 0;
+    if (_infD.is_negative())
+    {
+        out[pos++] = '-';
+    }
+    uint64_t integral = padding + digits.size() - scale; // characters before the point
+    for (uint64_t i = 0; i < padding + digits.size(); i++)
+    {
+        if (i == integral)
+        {
+            out[pos++] = '.';
+        }
+        if (i >= padding)
+        {
+            out[pos] = '0' + infPrecision_detail::abs_digit(digits[i - padding]);
+        }
+        pos++;
+    }
+    return out;
+}
+
+/**
+ * @brief Overloaded binary operator << to print a decimal number, see
+ * to_string()
+ *
+ * @param out An ostream object
+ * @param _infD A infDecimal object
+ * @return ostream& Returns a reference to an ostream object.
+ */
+ostream &operator<<(ostream &out, const infDecimal &_infD)
+{
+    string str = to_string(_infD);
+    return out.write(str.data(), str.size());
+}
+
+/**
+ * @brief Overloaded binary operator >> to read a decimal number from an
+ * istream character by character, straight into the digits of the
+ * mantissa. Leading whitespace is skipped, the number may start with '-',
+ * and reading stops before the first character which does not belong to
+ * it. The failbit is set if there is no digit or no digit after the point.
+ *
+ * @param in An istream object
+ * @param _infD A infDecimal object, 0 if no number can be read
+ * @return istream& Returns a reference to an istream object.
+ */
+istream &operator>>(istream &in, infDecimal &_infD)
+{
+    _infD = infDecimal();
+    istream::sentry sentry(in); // skips the whitespace
+    if (!sentry)
+    {
+        return in;
+    }
+    streambuf *buf = in.rdbuf();
+    bool negative = buf->sgetc() == '-';
+    if (negative)
+    {
+        buf->sbumpc();
+    }
+
+    vector<int64_t> digits;
+    uint64_t integral = 0;
+    bool point = false;
+    int c = buf->sgetc();
+    for (; c != char_traits<char>::eof(); c = buf->snextc())
+    {
+        if (infPrecision_detail::is_digit_char(c))
+        {
+            digits.push_back(c - '0');
+        }
+        else if (c == '.' && !point && !digits.empty())
+        {
+            point = true;
+            integral = digits.size();
+        }
+        else
+        {
+            break;
+        }
+    }
+    if (c == char_traits<char>::eof())
+    {
+        in.setstate(ios_base::eofbit);
+    }
+    if (!point)
+    {
+        integral = digits.size();
+    }
+    if (integral == 0 || (point && digits.size() == integral))
+    {
+        in.setstate(ios_base::failbit);
+        return in;
+    }
+    // If the integer part is not 0 and has leading 0s, throw exception
+    if (digits[0] == 0 && integral > 1)
+    {
+        throw infPrecision::cannot_leadZero();
+    }
+    _infD.scale = digits.size() - integral;
+    _infD.mantissa = infDecimal::make_mantissa(std::move(digits), negative);
+    return in;
+}
+
+#endif
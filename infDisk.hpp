@@ -0,0 +1,518 @@
+/**
+ * @file infDisk.hpp
+ * @brief Construct a class of disk-backed infinite precision integers, for
+ * operands larger than the memory. The limbs live in memory-mapped temporary
+ * files, and addition and multiplication stream them in segments with a
+ * bounded working memory (POSIX only).
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2022
+ *
+ */
+
+#ifndef INFDISK_HPP
+#define INFDISK_HPP
+
+#include "infPrecision.hpp"
+#include "infStream.hpp"
+#include <cstdlib>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+
+/**
+ * @brief Settings of the disk-backed integers
+ *
+ */
+struct infDiskOptions
+{
+    string directory;                             // temporary files, $TMPDIR or /tmp if empty
+    uint64_t memory_budget = uint64_t(256) << 20; // bytes of working memory of one operation
+};
+
+namespace infPrecision_detail
+{
+    /**
+     * @brief A range of limbs of a file mapped into memory, unmapped when
+     * the window is destroyed. Only the windows in use are resident, so the
+     * memory of an operation is bounded by the size of its windows.
+     *
+     */
+    class limb_window
+    {
+        void *base = MAP_FAILED;
+        uint64_t length = 0;
+        uint32_t *limbs = nullptr;
+
+    public:
+        limb_window(int _fd, uint64_t _first, uint64_t _count, bool _writable)
+        {
+            if (_count == 0)
+            {
+                return;
+            }
+            // The offset of a mapping must be a multiple of the page size
+            uint64_t page = sysconf(_SC_PAGESIZE);
+            uint64_t offset = _first * sizeof(uint32_t);
+            uint64_t aligned = offset / page * page;
+            length = offset - aligned + _count * sizeof(uint32_t);
+            base = mmap(nullptr, length, _writable ? PROT_READ | PROT_WRITE : PROT_READ, MAP_SHARED, _fd, aligned);
+            if (base == MAP_FAILED)
+            {
+                throw system_error(errno, generic_category(), "infDisk mmap");
+            }
+            limbs = (uint32_t *)((char *)base + (offset - aligned));
+        }
+        ~limb_window()
+        {
+            if (base != MAP_FAILED)
+            {
+                munmap(base, length);
+            }
+        }
+        limb_window(const limb_window &) = delete;
+        limb_window &operator=(const limb_window &) = delete;
+
+        uint32_t &operator[](uint64_t _i)
+        {
+            return limbs[_i];
+        }
+    };
+
+    /**
+     * @brief Create an anonymous temporary file of _bytes zero bytes. The
+     * file is unlinked at once, so it disappears with its descriptor.
+     *
+     */
+    int create_temp_file(const infDiskOptions &_options, uint64_t _bytes)
+    {
+        string directory = _options.directory;
+        if (directory.empty())
+        {
+            const char *tmpdir = getenv("TMPDIR");
+            directory = tmpdir != nullptr && *tmpdir != '\0' ? tmpdir : "/tmp";
+        }
+        string path = directory + "/infDiskXXXXXX";
+        int fd = mkstemp(&path[0]);
+        if (fd < 0)
+        {
+            throw system_error(errno, generic_category(), "infDisk temporary file");
+        }
+        unlink(path.c_str());
+        if (ftruncate(fd, _bytes) != 0)
+        {
+            int error = errno;
+            close(fd);
+            throw system_error(error, generic_category(), "infDisk temporary file");
+        }
+        return fd;
+    }
+
+    /**
+     * @brief Get the limbs of one segment, the unit streamed through memory.
+     * A multiplication holds about 16 segments worth of limbs at once (two
+     * operand segments, their product, the output window and the
+     * temporaries of Karatsuba's method).
+     *
+     */
+    uint64_t segment_limbs(const infDiskOptions &_options)
+    {
+        return max<uint64_t>(64, _options.memory_budget / (16 * sizeof(uint32_t)));
+    }
+}
+
+/**
+ * @brief Construct the class of disk-backed infinite precision integers. The
+ * magnitude is stored in the same base 10^9 limbs as the computations of
+ * infPrecision, from the least significant limb, in an unlinked temporary
+ * file; the sign is kept in memory. Objects can be moved but not copied.
+ *
+ */
+class infDisk
+{
+private:
+    int fd = -1;
+    uint64_t limbs = 0;
+    bool negative = false;
+    infDiskOptions options;
+
+    /**
+     * @brief Construct a infDisk object of _limbs zero limbs
+     *
+     */
+    infDisk(uint64_t _limbs, bool _negative, const infDiskOptions &_options)
+        : limbs(_limbs), negative(_negative), options(_options)
+    {
+        fd = infPrecision_detail::create_temp_file(options, limbs * sizeof(uint32_t));
+    }
+
+    /**
+     * @brief Drop the leading zero limbs, keeping one limb for integer 0
+     *
+     */
+    void trim()
+    {
+        uint64_t segment = infPrecision_detail::segment_limbs(options);
+        for (bool found = false; !found && limbs > 1;)
+        {
+            uint64_t lo = limbs > segment ? limbs - segment : 0;
+            infPrecision_detail::limb_window w(fd, lo, limbs - lo, false);
+            while (limbs > max<uint64_t>(lo, 1) && w[limbs - 1 - lo] == 0)
+            {
+                limbs--;
+            }
+            found = limbs > lo && w[limbs - 1 - lo] != 0;
+        }
+        if (ftruncate(fd, limbs * sizeof(uint32_t)) != 0)
+        {
+            throw system_error(errno, generic_category(), "infDisk trim");
+        }
+        if (limbs == 1 && infPrecision_detail::limb_window(fd, 0, 1, false)[0] == 0)
+        {
+            negative = false;
+        }
+    }
+
+    /**
+     * @brief Compare the magnitudes of two trimmed infDisk objects
+     *
+     */
+    static int compare_magnitude(const infDisk &_a, const infDisk &_b)
+    {
+        if (_a.limbs != _b.limbs)
+        {
+            return _a.limbs < _b.limbs ? -1 : 1;
+        }
+        uint64_t segment = infPrecision_detail::segment_limbs(_a.options);
+        for (uint64_t hi = _a.limbs; hi > 0;)
+        {
+            uint64_t lo = hi > segment ? hi - segment : 0;
+            infPrecision_detail::limb_window wa(_a.fd, lo, hi - lo, false), wb(_b.fd, lo, hi - lo, false);
+            for (uint64_t i = hi - lo; i-- > 0;)
+            {
+                if (wa[i] != wb[i])
+                {
+                    return wa[i] < wb[i] ? -1 : 1;
+                }
+            }
+            hi = lo;
+        }
+        return 0;
+    }
+
+    /**
+     * @brief Add _v to the limbs from _offset, carrying as far as needed
+     *
+     */
+    void add_at(uint64_t _offset, const vector<uint32_t> &_v)
+    {
+        uint64_t segment = infPrecision_detail::segment_limbs(options);
+        uint64_t carry = 0;
+        for (uint64_t pos = _offset; pos < limbs && (pos - _offset < _v.size() || carry > 0);)
+        {
+            uint64_t count = min(limbs - pos, pos - _offset < _v.size() ? _v.size() - (pos - _offset) : segment);
+            infPrecision_detail::limb_window w(fd, pos, count, true);
+            for (uint64_t i = 0; i < count; i++)
+            {
+                uint64_t k = pos - _offset + i;
+                uint64_t cur = (uint64_t)w[i] + carry + (k < _v.size() ? _v[k] : 0);
+                carry = cur >= infPrecision_detail::LIMB_BASE;
+                w[i] = cur - carry * infPrecision_detail::LIMB_BASE;
+            }
+            pos += count;
+        }
+    }
+
+    /**
+     * @brief Load limbs [_lo, _lo + _count) into memory
+     *
+     */
+    vector<uint32_t> load(uint64_t _lo, uint64_t _count) const
+    {
+        infPrecision_detail::limb_window w(fd, _lo, _count, false);
+        vector<uint32_t> v(_count);
+        for (uint64_t i = 0; i < _count; i++)
+        {
+            v[i] = w[i];
+        }
+        infPrecision_detail::trim_limbs(v);
+        return v;
+    }
+
+public:
+    /**
+     * @brief Construct a new infDisk object by a infPrecision object
+     *
+     * @param _infP A infPrecision object
+     * @param _options The directory of the temporary file and the memory budget
+     */
+    explicit infDisk(const infPrecision &_infP, const infDiskOptions &_options = infDiskOptions())
+        : infDisk(0, _infP.is_negative(), _options)
+    {
+        vector<uint32_t> v = infPrecision_detail::to_limbs(_infP);
+        limbs = v.size();
+        if (ftruncate(fd, limbs * sizeof(uint32_t)) != 0)
+        {
+            throw system_error(errno, generic_category(), "infDisk");
+        }
+        infPrecision_detail::limb_window w(fd, 0, limbs, true);
+        memcpy(&w[0], v.data(), limbs * sizeof(uint32_t));
+    }
+
+    infDisk(infDisk &&_other) noexcept
+        : fd(_other.fd), limbs(_other.limbs), negative(_other.negative), options(std::move(_other.options))
+    {
+        _other.fd = -1;
+    }
+
+    infDisk &operator=(infDisk &&_other) noexcept
+    {
+        swap(fd, _other.fd);
+        swap(limbs, _other.limbs);
+        swap(negative, _other.negative);
+        swap(options, _other.options);
+        return *this;
+    }
+
+    infDisk(const infDisk &) = delete;
+    infDisk &operator=(const infDisk &) = delete;
+
+    ~infDisk()
+    {
+        if (fd >= 0)
+        {
+            close(fd);
+        }
+    }
+
+    /**
+     * @brief Read a decimal integer from a regular file (or any file
+     * descriptor which supports pread) without loading it. The digits are
+     * converted to limbs segment by segment from the least significant end.
+     * The file must hold one integer, optionally surrounded by whitespace.
+     *
+     * @param _fd An open file descriptor
+     * @param _options The directory of the temporary file and the memory budget
+     * @return infDisk The integer read
+     */
+    static infDisk read_decimal(int _fd, const infDiskOptions &_options = infDiskOptions())
+    {
+        using namespace infPrecision_detail;
+        struct stat info;
+        if (fstat(_fd, &info) != 0)
+        {
+            throw system_error(errno, generic_category(), "infDisk read_decimal");
+        }
+        auto char_at = [_fd](uint64_t _pos)
+        {
+            char c;
+            if (pread(_fd, &c, 1, _pos) != 1)
+            {
+                throw system_error(errno, generic_category(), "infDisk read_decimal");
+            }
+            return c;
+        };
+
+        // Find the digits between the whitespace
+        uint64_t first = 0, last = info.st_size;
+        while (first < last && is_space_char(char_at(first)))
+        {
+            first++;
+        }
+        while (last > first && is_space_char(char_at(last - 1)))
+        {
+            last--;
+        }
+        bool negative = first < last && char_at(first) == '-';
+        first += negative;
+        if (first == last)
+        {
+            throw infPrecision::not_numerical();
+        }
+        // If an integer which is not 0, has leading 0s, throw exception
+        if (char_at(first) == '0' && last - first > 1)
+        {
+            throw infPrecision::cannot_leadZero();
+        }
+
+        uint64_t digits = last - first;
+        infDisk result((digits + LIMB_DIGITS - 1) / LIMB_DIGITS, negative, _options);
+        uint64_t segment = segment_limbs(_options);
+        string text;
+        for (uint64_t lo = 0; lo < result.limbs; lo += segment)
+        {
+            // Limb k holds the digits [last - 9(k+1), last - 9k)
+            uint64_t count = min(segment, result.limbs - lo);
+            uint64_t end = last - lo * LIMB_DIGITS;
+            uint64_t begin = end - first > count * LIMB_DIGITS ? end - count * LIMB_DIGITS : first;
+            text.resize(end - begin);
+            for (uint64_t done = 0; done < text.size();)
+            {
+                ssize_t n = pread(_fd, &text[done], text.size() - done, begin + done);
+                if (n <= 0)
+                {
+                    throw system_error(n < 0 ? errno : EIO, generic_category(), "infDisk read_decimal");
+                }
+                done += n;
+            }
+            limb_window w(result.fd, lo, count, true);
+            for (uint64_t k = 0; k < count; k++)
+            {
+                uint64_t hi = text.size() - k * LIMB_DIGITS;
+                uint64_t from = hi > LIMB_DIGITS ? hi - LIMB_DIGITS : 0;
+                uint32_t limb = 0;
+                for (uint64_t i = from; i < hi; i++)
+                {
+                    if (!is_digit_char(text[i]))
+                    {
+                        throw infPrecision::not_numerical();
+                    }
+                    limb = limb * 10 + (text[i] - '0');
+                }
+                w[k] = limb;
+            }
+        }
+        result.trim();
+        return result;
+    }
+
+    /**
+     * @brief Write the integer in decimal to a file descriptor, segment by
+     * segment from the most significant limb
+     *
+     * @param _fd An open file descriptor
+     */
+    void write_decimal(int _fd) const
+    {
+        using namespace infPrecision_detail;
+        uint64_t segment = segment_limbs(options);
+        string buffer = negative ? "-" : "";
+        for (uint64_t hi = limbs; hi > 0;)
+        {
+            uint64_t lo = hi > segment ? hi - segment : 0;
+            limb_window w(fd, lo, hi - lo, false);
+            for (uint64_t i = hi - lo; i-- > 0;)
+            {
+                string limb = to_string(w[i]);
+                // Every limb except the most significant one has 9 digits
+                if (lo + i + 1 < limbs)
+                {
+                    buffer.append(LIMB_DIGITS - limb.size(), '0');
+                }
+                buffer += limb;
+            }
+            write_block(_fd, buffer.data(), buffer.size());
+            buffer.clear();
+            hi = lo;
+        }
+    }
+
+    /**
+     * @brief Convert the integer back to a infPrecision object, which must
+     * fit in the memory
+     *
+     */
+    infPrecision to_infPrecision() const
+    {
+        return infPrecision_detail::from_limbs(load(0, limbs), negative);
+    }
+
+    /**
+     * @brief Get the number of base 10^9 limbs of the magnitude
+     *
+     */
+    uint64_t size() const
+    {
+        return limbs;
+    }
+
+    /**
+     * @brief Test if the integer is negative
+     *
+     */
+    bool is_negative() const
+    {
+        return negative;
+    }
+
+    friend infDisk operator+(const infDisk &_infD1, const infDisk &_infD2);
+    friend infDisk operator*(const infDisk &_infD1, const infDisk &_infD2);
+};
+
+/**
+ * @brief Overloaded binary operator + to calculate the summation of two
+ * infDisk objects. The limbs are streamed one segment at a time; the result
+ * is a new temporary file in the directory of the first operand.
+ *
+ * @param _infD1 The first disk-backed integer
+ * @param _infD2 The second disk-backed integer
+ * @return infDisk The summation
+ */
+infDisk operator+(const infDisk &_infD1, const infDisk &_infD2)
+{
+    using namespace infPrecision_detail;
+    // Let big hold the greater magnitude
+    bool swapped = infDisk::compare_magnitude(_infD1, _infD2) < 0;
+    const infDisk &big = swapped ? _infD2 : _infD1;
+    const infDisk &small = swapped ? _infD1 : _infD2;
+    bool subtract = big.negative != small.negative;
+
+    infDisk sum(big.limbs + 1, big.negative, _infD1.options);
+    uint64_t segment = segment_limbs(_infD1.options);
+    int64_t carry = 0;
+    for (uint64_t lo = 0; lo < big.limbs; lo += segment)
+    {
+        uint64_t count = min(segment, big.limbs - lo);
+        uint64_t small_count = lo < small.limbs ? min(count, small.limbs - lo) : 0;
+        limb_window wa(big.fd, lo, count, false), wb(small.fd, lo, small_count, false), ws(sum.fd, lo, count, true);
+        for (uint64_t i = 0; i < count; i++)
+        {
+            int64_t b = i < small_count ? (int64_t)wb[i] : 0;
+            int64_t cur = (int64_t)wa[i] + carry + (subtract ? -b : b);
+            carry = cur >= (int64_t)LIMB_BASE ? 1 : (cur < 0 ? -1 : 0);
+            ws[i] = cur - carry * (int64_t)LIMB_BASE;
+        }
+    }
+    limb_window(sum.fd, big.limbs, 1, true)[0] = carry;
+    sum.trim();
+    return sum;
+}
+
+/**
+ * @brief Overloaded binary operator * to calculate the multiplication of two
+ * infDisk objects. Both operands are cut into segments that fit in the
+ * memory budget; every pair of segments is multiplied in memory by
+ * mul_limbs (Karatsuba above the threshold) and added into the product file
+ * at its offset.
+ *
+ * @param _infD1 The first disk-backed integer
+ * @param _infD2 The second disk-backed integer
+ * @return infDisk The multiplication
+ */
+infDisk operator*(const infDisk &_infD1, const infDisk &_infD2)
+{
+    using namespace infPrecision_detail;
+    infDisk product(_infD1.limbs + _infD2.limbs, _infD1.negative != _infD2.negative, _infD1.options);
+    uint64_t segment = segment_limbs(_infD1.options);
+    for (uint64_t i = 0; i < _infD1.limbs; i += segment)
+    {
+        vector<uint32_t> a = _infD1.load(i, min(segment, _infD1.limbs - i));
+        if (is_zero_limbs(a))
+        {
+            continue;
+        }
+        for (uint64_t j = 0; j < _infD2.limbs; j += segment)
+        {
+            vector<uint32_t> b = _infD2.load(j, min(segment, _infD2.limbs - j));
+            if (!is_zero_limbs(b))
+            {
+                product.add_at(i + j, mul_limbs(a, b));
+            }
+        }
+    }
+    product.trim();
+    return product;
+}
+
+#endif
@@ -0,0 +1,702 @@
+/**
+ * @file infFixed.hpp
+ * @brief Construct a class template of fixed-width integers (128, 256, 512
+ * bits, ...) stored on the stack, for hot paths where the width is known at
+ * compile time. The values convert losslessly to and from infPrecision,
+ * which stays the arbitrary-precision fallback.
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2022
+ *
+ */
+
+#ifndef INFFIXED_HPP
+#define INFFIXED_HPP
+
+#include "infPrecision.hpp"
+
+namespace infPrecision_detail
+{
+    /**
+     * @brief Multiply two 64-bit words into a 128-bit product
+     *
+     * @param _a The first word
+     * @param _b The second word
+     * @param _lo Low 64 bits of the product
+     * @param _hi High 64 bits of the product
+     */
+    constexpr void mul_wide(uint64_t _a, uint64_t _b, uint64_t &_lo, uint64_t &_hi)
+    {
+#ifdef __SIZEOF_INT128__
+        unsigned __int128 p = (unsigned __int128)_a * _b;
+        _lo = (uint64_t)p;
+        _hi = (uint64_t)(p >> 64);
+#else
+        // Split both words into 32-bit halves
+        uint64_t a_lo = _a & 0xFFFFFFFF, a_hi = _a >> 32;
+        uint64_t b_lo = _b & 0xFFFFFFFF, b_hi = _b >> 32;
+        uint64_t p0 = a_lo * b_lo, p1 = a_lo * b_hi, p2 = a_hi * b_lo, p3 = a_hi * b_hi;
+        uint64_t mid = (p0 >> 32) + (p1 & 0xFFFFFFFF) + (p2 & 0xFFFFFFFF);
+        _lo = (mid << 32) | (p0 & 0xFFFFFFFF);
+        _hi = p3 + (p1 >> 32) + (p2 >> 32) + (mid >> 32);
+#endif
+    }
+}
+
+/**
+ * @brief Construct the class template of fixed-width integers. The value is
+ * stored in two's complement in Bits / 64 words from the least significant
+ * word. Every loop runs over a compile-time number of words, so the compiler
+ * unrolls it for each width, and every operator is usable in constexpr.
+ * Arithmetic wraps around modulo 2^Bits, the same as the built-in unsigned
+ * integers.
+ *
+ * @tparam Bits The width in bits, a positive multiple of 64
+ * @tparam Signed True for a signed integer, false for an unsigned integer
+ */
+template <uint64_t Bits, bool Signed = true>
+class infFixed
+{
+    static_assert(Bits > 0 && Bits % 64 == 0, "The width must be a positive multiple of 64 bits");
+
+public:
+    static constexpr uint64_t WORDS = Bits / 64; // number of 64-bit words
+
+private:
+    uint64_t words[WORDS] = {};
+
+public:
+    /**
+     * @brief Construct a default infFixed object with integer 0
+     *
+     */
+    constexpr infFixed() {}
+
+    /**
+     * @brief Construct a new infFixed object by 64bit fixed-width signed
+     * integer, sign-extended to the full width
+     *
+     * @param _64bit A 64bit fixed-width signed integer
+     */
+    constexpr infFixed(int64_t _64bit)
+    {
+        words[0] = (uint64_t)_64bit;
+        for (uint64_t i = 1; i < WORDS; i++)
+        {
+            words[i] = _64bit < 0 ? ~(uint64_t)0 : 0;
+        }
+    }
+
+    /**
+     * @brief Construct a new infFixed object by a infPrecision object
+     *
+     * @param _infP A infPrecision object, must fit in the width
+     */
+    explicit infFixed(const infPrecision &_infP)
+    {
+        // Out of range if |x| needs all Bits bits for signed types (except
+        // -2^(Bits-1)), or if it is negative or longer than Bits for unsigned
+        uint64_t length = _infP.bit_length();
+        if (!Signed && (_infP.is_negative() || length > Bits))
+        {
+            throw out_of_width();
+        }
+        if (Signed && length >= Bits &&
+            !(_infP.is_negative() && length == Bits && _infP.popcount() == 1))
+        {
+            throw out_of_width();
+        }
+
+        vector<uint32_t> halves = infPrecision_detail::limbs_to_words(infPrecision_detail::to_limbs(_infP));
+        for (uint64_t i = 0; i < halves.size(); i++)
+        {
+            words[i / 2] |= (uint64_t)halves[i] << (32 * (i % 2));
+        }
+        if (_infP.is_negative())
+        {
+            *this = -*this;
+        }
+    }
+
+    /**
+     * @brief Convert the infFixed object to a infPrecision object
+     *
+     * @return infPrecision The same integer with arbitrary precision
+     */
+    infPrecision to_infPrecision() const
+    {
+        bool negative = is_negative();
+        infFixed magnitude = negative ? -*this : *this;
+        vector<uint32_t> halves;
+        for (uint64_t i = 0; i < WORDS; i++)
+        {
+            halves.push_back((uint32_t)magnitude.words[i]);
+            halves.push_back((uint32_t)(magnitude.words[i] >> 32));
+        }
+        while (!halves.empty() && halves.back() == 0)
+        {
+            halves.pop_back();
+        }
+        return infPrecision_detail::from_limbs(infPrecision_detail::words_to_limbs(halves), negative);
+    }
+
+    /**
+     * @brief Get one 64-bit word of the two's complement form
+     *
+     * @param _i Index of the word, 0 is the least significant word
+     */
+    constexpr uint64_t get_word(uint64_t _i) const
+    {
+        return words[_i];
+    }
+
+    /**
+     * @brief Set one 64-bit word of the two's complement form
+     *
+     * @param _i Index of the word, 0 is the least significant word
+     * @param _word The new value of the word
+     */
+    constexpr void set_word(uint64_t _i, uint64_t _word)
+    {
+        words[_i] = _word;
+    }
+
+    /**
+     * @brief Test if the integer is negative, always false for unsigned types
+     *
+     */
+    constexpr bool is_negative() const
+    {
+        return Signed && (words[WORDS - 1] >> 63) == 1;
+    }
+
+    /**
+     * @brief Test if the integer is 0
+     *
+     */
+    constexpr bool is_zero() const
+    {
+        uint64_t any = 0;
+        for (uint64_t i = 0; i < WORDS; i++)
+        {
+            any |= words[i];
+        }
+        return any == 0;
+    }
+
+    /**
+     * @brief Overloaded prefix increment for fixed-width integer
+     *
+     * @return infFixed& infFixed object with prefix increment
+     */
+    constexpr infFixed &operator++()
+    {
+        // Only the trailing words of all 1s carry
+        for (uint64_t i = 0; i < WORDS && ++words[i] == 0; i++)
+        {
+        }
+        return *this;
+    }
+
+    /**
+     * @brief Overloaded postfix increment for fixed-width integer
+     *
+     * @return infFixed infFixed object before the increment
+     */
+    constexpr infFixed operator++(int)
+    {
+        infFixed temp = *this;
+        operator++();
+        return temp;
+    }
+
+    /**
+     * @brief Overloaded prefix decrement for fixed-width integer
+     *
+     * @return infFixed& infFixed object with prefix decrement
+     */
+    constexpr infFixed &operator--()
+    {
+        // Only the trailing words of all 0s borrow
+        for (uint64_t i = 0; i < WORDS && words[i]-- == 0; i++)
+        {
+        }
+        return *this;
+    }
+
+    /**
+     * @brief Overloaded postfix decrement for fixed-width integer
+     *
+     * @return infFixed infFixed object before the decrement
+     */
+    constexpr infFixed operator--(int)
+    {
+        infFixed temp = *this;
+        operator--();
+        return temp;
+    }
+
+    /**
+     * @brief Exception occurs when a infPrecision object does not fit in
+     * the width of the infFixed type
+     *
+     */
+    class out_of_width : public invalid_argument
+    {
+    public:
+        out_of_width() : invalid_argument("The integer does not fit in the fixed width!"){};
+    };
+};
+
+// Fixed-width integer types used by the hot paths
+typedef infFixed<128> infInt128;
+typedef infFixed<256> infInt256;
+typedef infFixed<512> infInt512;
+typedef infFixed<128, false> infUInt128;
+typedef infFixed<256, false> infUInt256;
+typedef infFixed<512, false> infUInt512;
+
+/**
+ * @brief Overloaded binary operator + to calculate the summation of two
+ * infFixed objects, wrapping around modulo 2^Bits
+ *
+ * @param _a The first fixed-width integer
+ * @param _b The second fixed-width integer
+ * @return infFixed<Bits, Signed> The result of addition
+ */
+template <uint64_t Bits, bool Signed>
+constexpr infFixed<Bits, Signed> operator+(const infFixed<Bits, Signed> &_a, const infFixed<Bits, Signed> &_b)
+{
+    infFixed<Bits, Signed> sum;
+    uint64_t carry = 0;
+    for (uint64_t i = 0; i < infFixed<Bits, Signed>::WORDS; i++)
+    {
+        uint64_t cur = _a.get_word(i) + carry;
+        carry = cur < carry;
+        cur += _b.get_word(i);
+        carry += cur < _b.get_word(i);
+        sum.set_word(i, cur);
+    }
+    return sum;
+}
+
+/**
+ * @brief Overloaded binary operator += to assign the summation
+ *
+ * @param _a The first fixed-width integer
+ * @param _b The second fixed-width integer
+ * @return infFixed<Bits, Signed>& Reassign _a with the result of addition
+ */
+template <uint64_t Bits, bool Signed>
+constexpr infFixed<Bits, Signed> &operator+=(infFixed<Bits, Signed> &_a, const infFixed<Bits, Signed> &_b)
+{
+    _a = _a + _b;
+    return _a;
+}
+
+/**
+ * @brief Overloaded binary operator - to calculate the subtraction of two
+ * infFixed objects, wrapping around modulo 2^Bits
+ *
+ * @param _a The first fixed-width integer
+ * @param _b The second fixed-width integer
+ * @return infFixed<Bits, Signed> The result of subtraction
+ */
+template <uint64_t Bits, bool Signed>
+constexpr infFixed<Bits, Signed> operator-(const infFixed<Bits, Signed> &_a, const infFixed<Bits, Signed> &_b)
+{
+    infFixed<Bits, Signed> diff;
+    uint64_t borrow = 0;
+    for (uint64_t i = 0; i < infFixed<Bits, Signed>::WORDS; i++)
+    {
+        uint64_t a = _a.get_word(i);
+        uint64_t cur = a - _b.get_word(i) - borrow;
+        borrow = (a < _b.get_word(i)) || (a == _b.get_word(i) && borrow);
+        diff.set_word(i, cur);
+    }
+    return diff;
+}
+
+/**
+ * @brief Overloaded binary operator -= to assign the subtraction
+ *
+ * @param _a The first fixed-width integer
+ * @param _b The second fixed-width integer
+ * @return infFixed<Bits, Signed>& Reassign _a with the result of subtraction
+ */
+template <uint64_t Bits, bool Signed>
+constexpr infFixed<Bits, Signed> &operator-=(infFixed<Bits, Signed> &_a, const infFixed<Bits, Signed> &_b)
+{
+    _a = _a - _b;
+    return _a;
+}
+
+/**
+ * @brief Overloaded unary operator - to get the two's complement negation
+ *
+ * @param _a The fixed-width integer
+ * @return infFixed<Bits, Signed> The negated integer
+ */
+template <uint64_t Bits, bool Signed>
+constexpr infFixed<Bits, Signed> operator-(const infFixed<Bits, Signed> &_a)
+{
+    return infFixed<Bits, Signed>() - _a;
+}
+
+/**
+ * @brief Overloaded binary operator * to calculate the multiplication of two
+ * infFixed objects. Only the words below the width are calculated, and the
+ * low half of two's complement products is the same for signed and
+ * unsigned integers.
+ *
+ * @param _a The first fixed-width integer
+ * @param _b The second fixed-width integer
+ * @return infFixed<Bits, Signed> The result of multiplication
+ */
+template <uint64_t Bits, bool Signed>
+constexpr infFixed<Bits, Signed> operator*(const infFixed<Bits, Signed> &_a, const infFixed<Bits, Signed> &_b)
+{
+    const uint64_t n = infFixed<Bits, Signed>::WORDS;
+    uint64_t product[n] = {};
+    for (uint64_t i = 0; i < n; i++)
+    {
+        uint64_t carry = 0;
+        for (uint64_t j = 0; i + j < n; j++)
+        {
+            uint64_t lo = 0, hi = 0;
+            infPrecision_detail::mul_wide(_a.get_word(i), _b.get_word(j), lo, hi);
+            lo += carry;
+            hi += lo < carry;
+            lo += product[i + j];
+            hi += lo < product[i + j];
+            product[i + j] = lo;
+            carry = hi;
+        }
+    }
+    infFixed<Bits, Signed> result;
+    for (uint64_t i = 0; i < n; i++)
+    {
+        result.set_word(i, product[i]);
+    }
+    return result;
+}
+
+/**
+ * @brief Overloaded binary operator *= to assign the multiplication
+ *
+ * @param _a The first fixed-width integer
+ * @param _b The second fixed-width integer
+ * @return infFixed<Bits, Signed>& Reassign _a with the result of multiplication
+ */
+template <uint64_t Bits, bool Signed>
+constexpr infFixed<Bits, Signed> &operator*=(infFixed<Bits, Signed> &_a, const infFixed<Bits, Signed> &_b)
+{
+    _a = _a * _b;
+    return _a;
+}
+
+/**
+ * @brief Overloaded binary operator << to shift the integer to the left
+ *
+ * @param _a The fixed-width integer
+ * @param _shift The number of bits to shift, bits beyond the width are lost
+ * @return infFixed<Bits, Signed> The shifted integer
+ */
+template <uint64_t Bits, bool Signed>
+constexpr infFixed<Bits, Signed> operator<<(const infFixed<Bits, Signed> &_a, uint64_t _shift)
+{
+    const uint64_t n = infFixed<Bits, Signed>::WORDS;
+    uint64_t word_shift = _shift / 64, bit_shift = _shift % 64;
+    infFixed<Bits, Signed> result;
+    for (uint64_t i = word_shift; i < n; i++)
+    {
+        uint64_t cur = _a.get_word(i - word_shift) << bit_shift;
+        if (bit_shift != 0 && i > word_shift)
+        {
+            cur |= _a.get_word(i - word_shift - 1) >> (64 - bit_shift);
+        }
+        result.set_word(i, cur);
+    }
+    return result;
+}
+
+/**
+ * @brief Overloaded binary operator >> to shift the integer to the right,
+ * arithmetically for signed types and logically for unsigned types
+ *
+ * @param _a The fixed-width integer
+ * @param _shift The number of bits to shift
+ * @return infFixed<Bits, Signed> The shifted integer
+ */
+template <uint64_t Bits, bool Signed>
+constexpr infFixed<Bits, Signed> operator>>(const infFixed<Bits, Signed> &_a, uint64_t _shift)
+{
+    const uint64_t n = infFixed<Bits, Signed>::WORDS;
+    uint64_t fill = _a.is_negative() ? ~(uint64_t)0 : 0;
+    uint64_t word_shift = _shift / 64, bit_shift = _shift % 64;
+    infFixed<Bits, Signed> result;
+    for (uint64_t i = 0; i < n; i++)
+    {
+        uint64_t low = i + word_shift < n ? _a.get_word(i + word_shift) : fill;
+        uint64_t high = i + word_shift + 1 < n ? _a.get_word(i + word_shift + 1) : fill;
+        result.set_word(i, bit_shift == 0 ? low : (low >> bit_shift) | (high << (64 - bit_shift)));
+    }
+    return result;
+}
+
+/**
+ * @brief Overloaded binary operator & to calculate the bitwise and
+ *
+ * @param _a The first fixed-width integer
+ * @param _b The second fixed-width integer
+ * @return infFixed<Bits, Signed> The result of bitwise and
+ */
+template <uint64_t Bits, bool Signed>
+constexpr infFixed<Bits, Signed> operator&(const infFixed<Bits, Signed> &_a, const infFixed<Bits, Signed> &_b)
+{
+    infFixed<Bits, Signed> result;
+    for (uint64_t i = 0; i < infFixed<Bits, Signed>::WORDS; i++)
+    {
+        result.set_word(i, _a.get_word(i) & _b.get_word(i));
+    }
+    return result;
+}
+
+/**
+ * @brief Overloaded binary operator | to calculate the bitwise or
+ *
+ * @param _a The first fixed-width integer
+ * @param _b The second fixed-width integer
+ * @return infFixed<Bits, Signed> The result of bitwise or
+ */
+template <uint64_t Bits, bool Signed>
+constexpr infFixed<Bits, Signed> operator|(const infFixed<Bits, Signed> &_a, const infFixed<Bits, Signed> &_b)
+{
+    infFixed<Bits, Signed> result;
+    for (uint64_t i = 0; i < infFixed<Bits, Signed>::WORDS; i++)
+    {
+        result.set_word(i, _a.get_word(i) | _b.get_word(i));
+    }
+    return result;
+}
+
+/**
+ * @brief Overloaded binary operator ^ to calculate the bitwise exclusive or
+ *
+ * @param _a The first fixed-width integer
+ * @param _b The second fixed-width integer
+ * @return infFixed<Bits, Signed> The result of bitwise exclusive or
+ */
+template <uint64_t Bits, bool Signed>
+constexpr infFixed<Bits, Signed> operator^(const infFixed<Bits, Signed> &_a, const infFixed<Bits, Signed> &_b)
+{
+    infFixed<Bits, Signed> result;
+    for (uint64_t i = 0; i < infFixed<Bits, Signed>::WORDS; i++)
+    {
+        result.set_word(i, _a.get_word(i) ^ _b.get_word(i));
+    }
+    return result;
+}
+
+/**
+ * @brief Overloaded unary operator ~ to get the bitwise not
+ *
+ * @param _a The fixed-width integer
+ * @return infFixed<Bits, Signed> The result of bitwise not
+ */
+template <uint64_t Bits, bool Signed>
+constexpr infFixed<Bits, Signed> operator~(const infFixed<Bits, Signed> &_a)
+{
+    infFixed<Bits, Signed> result;
+    for (uint64_t i = 0; i < infFixed<Bits, Signed>::WORDS; i++)
+    {
+        result.set_word(i, ~_a.get_word(i));
+    }
+    return result;
+}
+
+/**
+ * @brief Overloaded binary operator == to determine if two infFixed objects
+ * are equal
+ *
+ * @param _a The first fixed-width integer
+ * @param _b The second fixed-width integer
+ * @return bool Return true if two integers are equal, false otherwise
+ */
+template <uint64_t Bits, bool Signed>
+constexpr bool operator==(const infFixed<Bits, Signed> &_a, const infFixed<Bits, Signed> &_b)
+{
+    uint64_t diff = 0;
+    for (uint64_t i = 0; i < infFixed<Bits, Signed>::WORDS; i++)
+    {
+        diff |= _a.get_word(i) ^ _b.get_word(i);
+    }
+    return diff == 0;
+}
+
+/**
+ * @brief Overloaded binary operator != to determine if two infFixed objects
+ * are unequal
+ *
+ * @param _a The first fixed-width integer
+ * @param _b The second fixed-width integer
+ * @return bool Return true if two integers are unequal, false otherwise
+ */
+template <uint64_t Bits, bool Signed>
+constexpr bool operator!=(const infFixed<Bits, Signed> &_a, const infFixed<Bits, Signed> &_b)
+{
+    return !(_a == _b);
+}
+
+/**
+ * @brief Overloaded binary operator < to determine if the first infFixed
+ * object is smaller than the second infFixed object
+ *
+ * @param _a The first fixed-width integer
+ * @param _b The second fixed-width integer
+ * @return bool Return true if the first integer is smaller, false otherwise
+ */
+template <uint64_t Bits, bool Signed>
+constexpr bool operator<(const infFixed<Bits, Signed> &_a, const infFixed<Bits, Signed> &_b)
+{
+    // Integers with different signs are ordered by the sign
+    if (_a.is_negative() != _b.is_negative())
+    {
+        return _a.is_negative();
+    }
+    // Otherwise the two's complement words compare as unsigned integers
+    for (uint64_t i = infFixed<Bits, Signed>::WORDS; i-- > 0;)
+    {
+        if (_a.get_word(i) != _b.get_word(i))
+        {
+            return _a.get_word(i) < _b.get_word(i);
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief Overloaded binary operator > to determine if the first infFixed
+ * object is greater than the second infFixed object
+ *
+ */
+template <uint64_t Bits, bool Signed>
+constexpr bool operator>(const infFixed<Bits, Signed> &_a, const infFixed<Bits, Signed> &_b)
+{
+    return _b < _a;
+}
+
+/**
+ * @brief Overloaded binary operator <= to determine if the first infFixed
+ * object is smaller than or equal to the second infFixed object
+ *
+ */
+template <uint64_t Bits, bool Signed>
+constexpr bool operator<=(const infFixed<Bits, Signed> &_a, const infFixed<Bits, Signed> &_b)
+{
+    return !(_b < _a);
+}
+
+/**
+ * @brief Overloaded binary operator >= to determine if the first infFixed
+ * object is greater than or equal to the second infFixed object
+ *
+ */
+template <uint64_t Bits, bool Signed>
+constexpr bool operator>=(const infFixed<Bits, Signed> &_a, const infFixed<Bits, Signed> &_b)
+{
+    return !(_a < _b);
+}
+
+/**
+ * @brief Calculate the quotient and the remainder of dividing two infFixed
+ * objects. The quotient is truncated toward 0 and the remainder has the same
+ * sign as the dividend, the same as divmod() of infPrecision.
+ *
+ * @param _a The dividend
+ * @param _b The divisor, must not be 0
+ * @return pair<infFixed<Bits, Signed>, infFixed<Bits, Signed>> The quotient
+ * and the remainder
+ */
+template <uint64_t Bits, bool Signed>
+constexpr pair<infFixed<Bits, Signed>, infFixed<Bits, Signed>> divmod(const infFixed<Bits, Signed> &_a, const infFixed<Bits, Signed> &_b)
+{
+    if (_b.is_zero())
+    {
+        throw infPrecision::cannot_divideZero();
+    }
+    // Divide the magnitudes as unsigned integers
+    infFixed<Bits, false> u, v, q, r;
+    infFixed<Bits, Signed> abs_a = _a.is_negative() ? -_a : _a;
+    infFixed<Bits, Signed> abs_b = _b.is_negative() ? -_b : _b;
+    for (uint64_t i = 0; i < infFixed<Bits, Signed>::WORDS; i++)
+    {
+        u.set_word(i, abs_a.get_word(i));
+        v.set_word(i, abs_b.get_word(i));
+    }
+
+    // Restoring binary long division, one bit of the quotient at a time
+    for (uint64_t i = Bits; i-- > 0;)
+    {
+        r = r << 1;
+        r.set_word(0, r.get_word(0) | ((u.get_word(i / 64) >> (i % 64)) & 1));
+        if (r >= v)
+        {
+            r -= v;
+            q.set_word(i / 64, q.get_word(i / 64) | ((uint64_t)1 << (i % 64)));
+        }
+    }
+
+    infFixed<Bits, Signed> quotient, remainder;
+    for (uint64_t i = 0; i < infFixed<Bits, Signed>::WORDS; i++)
+    {
+        quotient.set_word(i, q.get_word(i));
+        remainder.set_word(i, r.get_word(i));
+    }
+    if (_a.is_negative() != _b.is_negative())
+    {
+        quotient = -quotient;
+    }
+    if (_a.is_negative())
+    {
+        remainder = -remainder;
+    }
+    return make_pair(quotient, remainder);
+}
+
+/**
+ * @brief Overloaded binary operator / to calculate the truncated quotient
+ *
+ */
+template <uint64_t Bits, bool Signed>
+constexpr infFixed<Bits, Signed> operator/(const infFixed<Bits, Signed> &_a, const infFixed<Bits, Signed> &_b)
+{
+    return divmod(_a, _b).first;
+}
+
+/**
+ * @brief Overloaded binary operator % to calculate the remainder
+ *
+ */
+template <uint64_t Bits, bool Signed>
+constexpr infFixed<Bits, Signed> operator%(const infFixed<Bits, Signed> &_a, const infFixed<Bits, Signed> &_b)
+{
+    return divmod(_a, _b).second;
+}
+
+/**
+ * @brief Overloaded binary operator << to print the integer stored in
+ * infFixed object
+ *
+ * @param out An ostream object
+ * @param _a A infFixed object
+ * @return ostream& Returns a reference to an ostream object.
+ */
+template <uint64_t Bits, bool Signed>
+ostream &operator<<(ostream &out, const infFixed<Bits, Signed> &_a)
+{
+    return out << _a.to_infPrecision();
+}
+
+#endif
@@ -1,972 +1,3492 @@
-/**
- * @file infPrecision.hpp
- * @author Yiqi Huang (huany132@mcmaster.ca)
- * @brief Construct a class that allow to store a infinite precision integer
- * by vector, and overload several basic binary and unary operators of
- * mathmatical arithmetics and comparison.
- * @version 0.1
- * @date 2022-11-27
- *
- * @copyright Copyright (c) 2022
- *
- */
-
-#include <iostream>
-#include <stdexcept>
-#include <vector>
-#include <string>
-#include <algorithm>
-using namespace std;
-
-/**
- * @brief Construct the class of infinite precision integer
- *
- */
-class infPrecision
-{
-private:
-    vector<int64_t> integer;
-
-public:
-    /**
-     * @brief Construct a default infPrecision object with integer 0
-     *
-     */
-    infPrecision()
-    {
-        integer = {0};
-    }
-
-    /**
-     * @brief Construct a new infPrecision object by numerical string
-     *
-     * @param _str A numerical string
-     */
-    infPrecision(const string &_str)
-    {
-        // If an integer which is not 0, has leading 0s, throw exception
-        if (_str[0] == '0' && _str.size() > 1)
-        {
-            throw cannot_leadZero();
-        }
-        else if (_str[0] == '-') // If the first character is negative sign
-        {
-            if (isdigit(_str[1]) == 1)
-            {
-                integer.push_back((_str[1] - '0') * (-1)); // store the first digit as negative number
-            }
-            else
-            {
-                throw not_numerical();
-            }
-            for (uint64_t i = 2; i < _str.size(); i++)
-            {
-                // if all char in string is numerical or the first char is '-'
-                if (isdigit(_str[i]) == 1)
-                {
-                    integer.push_back(_str[i] - '0'); // store string char by char in integer form
-                }
-                else
-                {
-                    throw not_numerical();
-                }
-            }
-        }
-        else
-        {
-            for (uint64_t i = 0; i < _str.size(); i++)
-            {
-                // If all char in string is numerical or the first char is '-'
-                if (isdigit(_str[i]) == 1)
-                {
-                    integer.push_back(_str[i] - '0'); // store string char by char in integer form
-                }
-                else
-                {
-                    throw not_numerical();
-                }
-            }
-        }
-    }
-    /**
-     * @brief Construct a new infPrecision object by 64bit fixed-width signed integer
-     *
-     * @param _64bit A 64bit fixed-width signed integer
-     */
-    infPrecision(int64_t &_64bit)
-    {
-        int64_t absolute = abs(_64bit); // take the absolute value of the input integer
-        while (absolute > 0)
-        {
-            integer.push_back((int)(absolute % 10));
-            absolute /= 10;
-        }
-        reverse(integer.begin(), integer.end());
-        if (_64bit < 0)
-        {
-            integer[0] = integer[0] * -1;
-        }
-    }
-
-    /**
-     * @brief Construct a new infPrecision object by a int64_t type vector
-     *
-     * @param _vec A int64_t type vector
-     */
-    infPrecision(vector<int64_t> &_vec)
-    {
-        // If an integer which is not 0, has leading 0s, throw exception
-        if (_vec[0] == 0 && _vec.size() > 1)
-        {
-            throw cannot_leadZero();
-        }
-        for (uint64_t i = 1; i < _vec.size(); i++)
-        {
-            // If an integer in the vector other than the first one is
-            // a negative number, throw exception
-            if (_vec[i] < 0)
-            {
-                throw cannot_negative();
-            }
-
-            // If an integer in the vector has two digits, throw exception
-            if ((abs)(_vec[i]) >= 10)
-            {
-                throw cannot_mulDigits();
-            }
-        }
-        integer = _vec;
-    }
-
-    /**
-     * @brief Get the vector of a infPrecision object
-     *
-     */
-    vector<int64_t> get_vec() const
-    {
-        return integer;
-    }
-
-    /**
-     * @brief Test if the integer in a infPrecision object is negative
-     *
-     */
-    bool is_negative() const
-    {
-        if (integer[0] < 0)
-        {
-            return 1; // The integer is negative
-        }
-        return 0;
-    }
-
-    /**
-     * @brief Overloaded prefix increment for infinite precision integer
-     *
-     * @return infPrecision& InfPrecision object with prefix increment
-     */
-    infPrecision &operator++()
-    {
-        // Reverse the vector for doing iteration easier later
-        reverse(integer.begin(), integer.end());
-        uint64_t s = integer.size(); // size of the vector
-
-        if (integer[s - 1] >= 0) // if the number is non-negative
-        {
-            integer[0] = integer[0] + 1; // Increment the number by 1
-            for (uint64_t i = 0; i < s; i++)
-            {
-                // If the sum caused a digit greater than 10
-                if (integer[i] >= 10)
-                {
-                    integer[i] = integer[i] % 10; // Each element only keep one digit
-                    // If this happens on the first digit,
-                    // add one more digit to hold the incremented 1.
-                    if (i == s - 1)
-                    {
-                        integer.push_back(0);
-                    }
-                    integer[i + 1] += 1; // Next element will also increment by 1
-                }
-            }
-            // reverse the vector back to normal
-            reverse(integer.begin(), integer.end());
-        }
-        // If the number is negative, treat it as a positive number with decrement
-        else if (integer[s - 1] < 0)
-        {
-            // Turn the number to positive
-            integer[s - 1] = integer[s - 1] * (-1);
-            // Decrement the last digit
-            integer[0] = integer[0] - 1;
-
-            for (uint64_t i = 0; i < s; i++)
-            {
-                // If one digit is negative after decrement
-                if (integer[i] < 0)
-                {
-                    integer[i] = 9;      // It will become 9 instead
-                    integer[i + 1] -= 1; // Decrement its next digit
-                }
-            }
-            reverse(integer.begin(), integer.end());
-
-            // Eliminate leading 0s until a non-zero integer, or a single 0 left
-            if (integer.size() > 1)
-            {
-                while (integer[0] == 0)
-                {
-                    integer.erase(integer.begin());
-                }
-            }
-            // Turn the number back to negative
-            integer[0] = integer[0] * (-1);
-        }
-
-        return *this;
-    }
-
-    /**
-     * @brief Overloaded postfix increment for infinite precision integer
-     *
-     * @return infPrecision& InfPrecision object with postfix increment
-     */
-    infPrecision operator++(int)
-    {
-        infPrecision temp = *this;
-        operator++();
-        return temp;
-    }
-
-    /**
-     * @brief Overloaded prefix decrement for infinite precision integer
-     *
-     * @return infPrecision& InfPrecision object with prefix decrement
-     */
-    infPrecision &operator--()
-    {
-        // Reverse the vector for doing iteration easier later
-        reverse(integer.begin(), integer.end());
-        uint64_t s = integer.size(); // size of the vector
-
-        // If the number is negative, treat it as a positive number with increment
-        if (integer[s - 1] < 0)
-        {
-            // Turn the number to positive
-            integer[s - 1] = integer[s - 1] * (-1);
-            // Decrement of a negative number is plus 1
-            integer[0] = integer[0] + 1;
-            for (uint64_t i = 0; i < s; i++)
-            {
-                // If the sum caused a digit greater than 10
-                if (integer[i] >= 10)
-                {
-                    integer[i] = integer[i] % 10; // Each element only keep one digit
-                    // If this happens on the first digit,
-                    // add one more digit to hold the incremented 1.
-                    if (i == s - 1)
-                    {
-                        integer.push_back(0);
-                    }
-                    integer[i + 1] += 1; // Next element will also increment by 1
-                }
-            }
-            // reverse the vector back to normal
-            reverse(integer.begin(), integer.end());
-            // Turn the number back to negative
-            integer[0] = integer[0] * (-1);
-        }
-        // If the number is non-negative
-        else if (integer[s - 1] >= 0)
-        {
-            // Decrement the last digit
-            integer[0] = integer[0] - 1;
-
-            for (uint64_t i = 0; i < s; i++)
-            {
-                // If there is one digit is negative after decrement and the
-                // number size is greater than 1
-                if (integer[i] < 0 && s > 1)
-                {
-                    integer[i] = 9;      // It will become 9 instead
-                    integer[i + 1] -= 1; // Decrement its next digit
-                }
-                // If the current number is just 0
-                else if (integer[i] < 0 && s == 1)
-                {
-                    integer[i] = -1;
-                }
-            }
-            reverse(integer.begin(), integer.end());
-
-            // Eliminate leading 0s until a non-zero integer, or a single 0 left
-            if (integer.size() > 1)
-            {
-                while (integer[0] == 0)
-                {
-                    integer.erase(integer.begin());
-                }
-            }
-        }
-        return *this;
-    }
-
-    /**
-     * @brief Overloaded postfix decrement for infinite precision integer
-     *
-     * @return infPrecision& InfPrecision object with postfix decrement
-     */
-    infPrecision operator--(int)
-    {
-        infPrecision temp = *this;
-        operator--();
-        return temp;
-    }
-
-    // Copy constructor
-    infPrecision(const infPrecision &_infP)
-    {
-        integer = _infP.get_vec();
-    }
-
-    /**
-     * @brief Overloaded binary operator = to assign one infPrecision object
-     * a new value from another infPrecision
-     *
-     * @param _infP infPrecision object we want to assign from
-     * @return infPrecision& infPrecision object with the new value
-     */
-    infPrecision &operator=(const infPrecision &_infP)
-    {
-        if (this == &_infP)
-            return *this;
-        integer = _infP.get_vec();
-        return *this;
-    }
-
-    /**
-     * @brief Exception occurs when string in constructor has
-     * non-numerical character
-     *
-     */
-    class not_numerical : public invalid_argument
-    {
-    public:
-        not_numerical() : invalid_argument("Input is not numerical!"){};
-    };
-
-    /**
-     * @brief Exception occurs when vector in constructor has an item (not the
-     * first item) is negative numbers
-     *
-     */
-    class cannot_negative : public invalid_argument
-    {
-    public:
-        cannot_negative() : invalid_argument("Cannot have negative number other than the first item!"){};
-    };
-
-    /**
-     * @brief Exception occurs when vector in constructor has an item is
-     * mult-digits number.
-     *
-     */
-    class cannot_mulDigits : public invalid_argument
-    {
-    public:
-        cannot_mulDigits() : invalid_argument("Cannot have a number more than 1 digit in vector!"){};
-    };
-
-    /**
-     * @brief Exception occurs when vector in constructor or string in
-     * constructor has leading zeros in the front, where the integer is not 0
-     *
-     */
-    class cannot_leadZero : public invalid_argument
-    {
-    public:
-        cannot_leadZero() : invalid_argument("Cannot have leading zeros!"){};
-    };
-};
-
-// Forward declaration
-infPrecision operator+(const infPrecision &_infP1, const infPrecision &_infP2);
-infPrecision operator+=(infPrecision &_infP1, const infPrecision &_infP2);
-infPrecision operator-(const infPrecision &_infP1, const infPrecision &_infP2);
-infPrecision operator-=(infPrecision &_infP1, const infPrecision &_infP2);
-infPrecision operator*(const infPrecision &_infP1, const infPrecision &_infP2);
-infPrecision operator*=(infPrecision &_infP1, const infPrecision &_infP2);
-infPrecision operator-(const infPrecision &_infP);
-bool operator==(const infPrecision &_infP1, const infPrecision &_infP2);
-bool operator!=(const infPrecision &_infP1, const infPrecision &_infP2);
-bool operator>(const infPrecision &_infP1, const infPrecision &_infP2);
-bool operator>=(const infPrecision &_infP1, const infPrecision &_infP2);
-bool operator<(const infPrecision &_infP1, const infPrecision &_infP2);
-bool operator<=(const infPrecision &_infP1, const infPrecision &_infP2);
-
-/**
- * @brief Overloaded binary operator + to calculate the summation of the
- * first infPrecision object with the second infPrecision object
- *
- * @param _infP1 The first infinite precision integer
- * @param _infP2 The second infinite precision integer
- * @return infPrecision A infPrecision object as the result of addition.
- */
-infPrecision operator+(const infPrecision &_infP1, const infPrecision &_infP2)
-{
-    uint64_t s = 0;    // size of longer integer
-    uint64_t diff = 0; // size difference between two integers
-    vector<int64_t> vec1 = _infP1.get_vec();
-    vector<int64_t> vec2 = _infP2.get_vec();
-    reverse(vec1.begin(), vec1.end());
-    reverse(vec2.begin(), vec2.end());
-
-    // If the first integer is longer
-    if (vec1.size() >= vec2.size())
-    {
-        s = vec1.size();
-        diff = vec1.size() - vec2.size();
-
-        // the shorter integer expands with extra 0s
-        // to be th same size as the longer one
-        vec2.insert(vec2.end(), diff, 0);
-    }
-    // If the second integer is longer
-    else
-    {
-        s = vec2.size();
-        diff = vec2.size() - vec1.size();
-
-        // the shorter integer expands with extra 0s
-        // to be th same size as the longer one
-        vec1.insert(vec1.end(), diff, 0);
-    }
-
-    vector<int64_t> sum; // store result
-
-    // if x > 0, y < 0, then x + y = x +(-y'), where y' = -y
-    // This is also the process of doing regular subtraction (where both integers
-    // are positive)
-    if (_infP1.is_negative() == 0 && _infP2.is_negative() == 1)
-    {
-        int64_t temp;
-        // if first integer is bigger than second integer when they are all positive
-        if (_infP1 >= -(_infP2))
-        {
-            for (uint64_t i = 0; i < vec1.size(); i++)
-            {
-                // if the correct digit in vec1 is smaller
-                if (vec1[i] < (abs)(vec2[i]))
-                {
-                    // firstly add 10 in vec1[i] then subtract vec2[i]
-                    temp = (vec1[i] + 10) - (abs)(vec2[i]);
-                    sum.push_back(temp);
-                    for (uint64_t j = i + 1; j < vec1.size(); j++)
-                    {
-                        // If next digit is 0, decrease to 9
-                        if (vec1[j] == 0)
-                        {
-                            vec1[j] = 9;
-                        }
-                        // Otherwise, next digit decreases by 1
-                        else
-                        {
-                            vec1[j] -= 1;
-                            break; // Only one digit decreases
-                        }
-                    }
-                    continue;
-                }
-                // Otherwise, do the regular subtraction
-                temp = vec1[i] - (abs)(vec2[i]);
-                sum.push_back(temp);
-            }
-            reverse(sum.begin(), sum.end());
-            // If the result is not 0, remove all leading 0s
-            if (sum.size() > 1)
-            {
-                while (sum[0] == 0)
-                {
-                    sum.erase(sum.begin());
-                }
-            }
-            infPrecision summation = infPrecision(sum);
-            return summation;
-        }
-
-        // if first integer is smaller than second integer when they are all positive
-        else if (_infP1 < -(_infP2))
-        {
-            // Recall this function in a new order so we can
-            // solve this by previous if statement
-            // Ex: a = 9; b = -10
-            // 9 + (-10) = -(10 + (-9))
-            infPrecision holder = -((-_infP2) + (-_infP1));
-            return holder;
-        }
-    }
-
-    // if x < 0, y > 0
-    else if (_infP1.is_negative() == 1 && _infP2.is_negative() == 0)
-    {
-        // x + y = y + x, then we can use the first if-statement to solve this
-        infPrecision holder = _infP2 + _infP1;
-        return holder;
-    }
-
-    // if x < 0, y < 0
-    else if (_infP1.is_negative() == 1 && _infP2.is_negative() == 1)
-    {
-        // x + y = -(-x + -y), where -x > 0 and -y > 0.
-        // Consider this as a negation of two positive integers' addition.
-        // We use the up-coming statements (when x,y>0) to implement this.
-        infPrecision holder = -((-_infP1) + (-_infP2));
-        return holder;
-    }
-
-    // If x > 0 and y > 0, we have the regular summation
-    for (uint64_t i = 0; i < s; i++)
-    {
-        int64_t temp;
-        temp = (vec1[i] + vec2[i]); // add digit by digit
-        sum.push_back(temp);
-    }
-    for (uint64_t i = 0; i < s; i++)
-    {
-        // If the previous digits' addition is above 10, get rid of the 10
-        // and add 1 to the next digit
-        if (sum[i] >= 10)
-        {
-            sum[i] = sum[i] % 10; // Each element only keep one digit
-            // If this happens on the first digit,
-            // add one more digit to hold the incremented 1.
-            if (i == s - 1)
-            {
-                sum.push_back(0);
-            }
-            sum[i + 1] += 1;
-        }
-    }
-
-    reverse(sum.begin(), sum.end());
-    infPrecision summation = infPrecision(sum);
-    return summation;
-}
-
-/**
- * @brief Overloaded binary operator += to assign the new value of the left
- * infPrecision object after it plus the right infPrecision object
- *
- * @param _infP1 The first infinite precision integer
- * @param _infP2 The second infinite precision integer
- * @return infPrecision A infPrecision object as the result of subtraction.
- */
-infPrecision operator+=(infPrecision &_infP1, const infPrecision &_infP2)
-{
-    _infP1 = _infP1 + _infP2;
-    return _infP1;
-}
-
-/**
- * @brief Overloaded binary operator - to calculate the subtraction of the
- * left infPrecision object with the right infPrecision object
- *
- * @param _infP1 The first infinite precision integer
- * @param _infP2 The second infinite precision integer
- * @return infPrecision Reassign _infP1 with the result of addition
- */
-infPrecision operator-(const infPrecision &_infP1, const infPrecision &_infP2)
-{
-    infPrecision subtraction;
-    // if x > 0, y < 0, then x - y = x + y' = x + (-y), where y'= -y
-    if (_infP1.is_negative() == 0 && _infP2.is_negative() == 1)
-    {
-        subtraction = _infP1 + (-_infP2);
-        return subtraction;
-    }
-
-    // if x < 0, y < 0, then x - y = (-x') - (-y') = y'- x' = (-y) + x,
-    // where x'= -x, y'= -y
-    else if (_infP1.is_negative() == 1 && _infP2.is_negative() == 1)
-    {
-        subtraction = (-_infP2) + _infP1;
-        return subtraction;
-    }
-
-    // if x < 0, y > 0, then x - y = -x'- y = -(x'+ y), where x'= -x
-    else if (_infP1.is_negative() == 1 && _infP2.is_negative() == 0)
-    {
-        subtraction = -((-_infP1) + _infP2);
-        return subtraction;
-    }
-
-    // If x > 0 and y > 0, we have the regular subtraction
-    // x - y = x + (-y)
-    subtraction = _infP1 + (-(_infP2));
-    return subtraction;
-}
-
-/**
- * @brief Overloaded binary operator -= to assign the new value of the first
- * infPrecision object after it subtracts the second infPrecision object
- *
- * @param _infP1 The first infinite precision integer
- * @param _infP2 The second infinite precision integer
- * @return infPrecision Reassign _infP1 with the result of multiplication
- */
-infPrecision operator-=(infPrecision &_infP1, const infPrecision &_infP2)
-{
-    _infP1 = _infP1 - _infP2;
-    return _infP1;
-}
-
-/**
- * @brief Overloaded binary operator * to calculate the multiplication of the
- * first infPrecision object with the second infPrecision object
- *
- * @param _infP1 The first infinite precision integer
- * @param _infP2 The second infinite precision integer
- * @return infPrecision The result of multiplication in a new infinite
- * precision integer
- */
-infPrecision operator*(const infPrecision &_infP1, const infPrecision &_infP2)
-{
-    vector<int64_t> vec1 = _infP1.get_vec();
-    vector<int64_t> vec2 = _infP2.get_vec();
-
-    // Return true if one of the number is negative, which means we will have
-    // a negative product
-    bool neg_product = 0;
-    if ((vec1[0] < 0 && vec2[0] > 0) || (vec2[0] < 0 && vec1[0] > 0))
-    {
-        neg_product = 1;
-    }
-    reverse(vec1.begin(), vec1.end());
-    reverse(vec2.begin(), vec2.end());
-
-    // Create an empty vector for storing the result of multiplication
-    // The digits of product <= digits of first number + digits of second number
-    // Ex: 99 * 999 = 98901
-    vector<int64_t> mult(vec1.size() + vec2.size(), 0);
-
-    // Fill multiplicand by 0s if its size is smaller than mult
-    if (mult.size() > vec2.size())
-    {
-        uint64_t diff = mult.size() - vec2.size();
-        vec2.insert(vec2.end(), diff, 0);
-    }
-
-    for (uint64_t i = 0; i < vec2.size(); i++)
-    {
-        vector<int64_t> temp(mult.size(), 0);
-        for (uint64_t j = 0; j < vec1.size(); j++)
-        {
-            // temp stores the current number of the multiplication between
-            // a single digit from second integer and entire first integer
-            temp[j] += (abs)(vec1[j]) * (abs)(vec2[i]);
-            // If one element in the temp is a two-digit number
-            if (temp[j] >= 10)
-            {
-                // add extra numbers into next digit
-                temp[j + 1] += temp[j] / 10;
-
-                // Each element only keep one digit
-                temp[j] = temp[j] % 10;
-            }
-        }
-
-        while (temp.back() == 0)
-        {
-            temp.pop_back();
-            if (temp.size() == 1)
-            {
-                break;
-            }
-        }
-
-        // The starting index of the first number is with i = 0.
-        // i increases in next iteration, so we can also shift the
-        // index to match up next number for the addition
-        uint64_t k = i;
-        for (uint64_t l = 0; l < temp.size(); l++)
-        {
-            mult[k] += temp[l];
-            if (mult[k] >= 10)
-            {
-                // Each element only keep one digit
-                mult[k] = mult[k] % 10;
-                // Increment one in next digit
-                mult[k + 1] += 1;
-            }
-            // Increase k for storing every digit from current number in mult
-            k++;
-        }
-
-        // cout << "\n";
-        temp.clear();
-    }
-
-    // If the result is not 0, remove all leading 0s
-    while (mult.back() == 0)
-    {
-        mult.pop_back();
-        if (mult.size() == 1)
-        {
-            break;
-        }
-    }
-    reverse(mult.begin(), mult.end());
-
-    // If there is one negative number, then the product should be negative
-    if (neg_product == 1)
-    {
-        mult[0] *= (-1);
-    }
-    infPrecision multiplication = infPrecision(mult);
-    return multiplication;
-}
-
-/**
- * @brief Overloaded binary operator *= to assign the new value of the first
- * infPrecision object after it multiplies the second infPrecision object
- *
- * @param _infP1 The first infinite precision integer
- * @param _infP2 The second infinite precision integer
- * @return infPrecision Reassign _infP1 with the result of multiplication
- */
-infPrecision operator*=(infPrecision &_infP1, const infPrecision &_infP2)
-{
-    _infP1 = _infP1 * _infP2;
-    return _infP1;
-}
-
-/**
- * @brief Overloaded unary operator - to get the negative of
- * infPrecision object
- *
- * @param _infP The infinite precision integer
- * @return infPrecision The negated infinite precision integer
- */
-infPrecision operator-(const infPrecision &_infP)
-{
-    vector<int64_t> temp = _infP.get_vec();
-    temp[0] = temp[0] * (-1); // First digit multiplies -1
-    infPrecision invert = infPrecision(temp);
-    return invert;
-}
-
-/**
- * @brief Overloaded binary operator == to determine if the first
- * infPrecision object is equal to the second infPrecision object
- *
- * @param _infP1 The first infinite precision integer
- * @param _infP2 The second infinite precision integer
- * @return bool Return true if two infPrecision are equal, false otherwise
- */
-bool operator==(const infPrecision &_infP1, const infPrecision &_infP2)
-{
-    return (_infP1.get_vec() == _infP2.get_vec());
-}
-
-/**
- * @brief Overloaded binary operator != to determine if the first
- * infPrecision object is unequal to the second infPrecision object
- *
- * @param _infP1 The first infinite precision integer
- * @param _infP2 The second infinite precision integer
- * @return bool Return true if two infPrecision are unequal, false otherwise
- */
-bool operator!=(const infPrecision &_infP1, const infPrecision &_infP2)
-{
-    return (_infP1.get_vec() != _infP2.get_vec());
-}
-
-/**
- * @brief Overloaded binary operator < to determine if the first
- * infPrecision object is smaller than the second infPrecision object
- *
- * @param _infP1 The first infinite precision integer
- * @param _infP2 The second infinite precision integer
- * @return bool Return true if first infPrecision is smaller than
- * second infPrecision, false otherwise
- */
-bool operator<(const infPrecision &_infP1, const infPrecision &_infP2)
-{
-    vector<int64_t> vec1 = _infP1.get_vec();
-    vector<int64_t> vec2 = _infP2.get_vec();
-
-    // if x is negative, y is non-negative, then x<y
-    if (vec1[0] < 0 && vec2[0] >= 0)
-    {
-        return true;
-    }
-    // if x,y are both negative
-    else if (vec1[0] < 0 && vec2[0] < 0)
-    {
-        // the larger the negative integer's size, the smaller its value
-        if (vec1.size() > vec2.size())
-        {
-            return true;
-        }
-        // if both negative integers have the same size
-        else if (vec1.size() == vec2.size())
-        {
-            for (uint64_t i = 0; i < vec1.size(); i++)
-            {
-                // for negative numbers, if one of the digit's absolute value
-                // in x is bigger than the corresponding digit's absolute value
-                // in y, then x < y
-                if ((abs)(vec1[i]) > (abs)(vec2[i]))
-                {
-                    return true;
-                }
-            }
-        }
-        return false;
-    }
-    // if x,y are both non-negative
-    else if (vec1[0] >= 0 && vec2[0] >= 0)
-    {
-        // the smaller the positive integer's size, the smaller its value
-        if (vec1.size() < vec2.size())
-        {
-            return true;
-        }
-        // if both positive integers have the same size
-        else if (vec1.size() == vec2.size())
-        {
-            for (uint64_t i = 0; i < vec1.size(); i++)
-            {
-                // if one of the digit in x is smaller
-                // than the corresponding digit in y, then x < y
-                if (vec1[i] < vec2[i])
-                {
-                    return true;
-                }
-            }
-        }
-        return false;
-    }
-    return false;
-}
-
-/**
- * @brief Overloaded binary operator <= to determine if the first
- * infPrecision object is smaller than or equal to the second infPrecision object
- *
- * @param _infP1 The first infinite precision integer
- * @param _infP2 The second infinite precision integer
- * @return bool Return true if first infPrecision is smaller than or equal to the
- * second infPrecision, false otherwise
- */
-bool operator<=(const infPrecision &_infP1, const infPrecision &_infP2)
-{
-    if (_infP1 < _infP2 || _infP1 == _infP2)
-    {
-        return true;
-    }
-    return false;
-}
-
-/**
- * @brief Overloaded binary operator > to determine if the first
- * infPrecision object is greater than the second infPrecision object
- *
- * @param _infP1 The first infinite precision integer
- * @param _infP2 The second infinite precision integer
- * @return bool Return true if first infPrecision is greater than the
- * second infPrecision, false otherwise
- */
-bool operator>(const infPrecision &_infP1, const infPrecision &_infP2)
-{
-    vector<int64_t> vec1 = _infP1.get_vec();
-    vector<int64_t> vec2 = _infP2.get_vec();
-
-    // if x is non-negative, y is negative, then x>y
-    if (vec1[0] >= 0 && vec2[0] < 0)
-    {
-        return true;
-    }
-    // if x,y are both negative
-    else if (vec1[0] < 0 && vec2[0] < 0)
-    {
-        // the larger the negative integer's size, the smaller its value
-        if (vec1.size() < vec2.size())
-        {
-            return true;
-        }
-        // if both negative integers have the same size
-        else if (vec1.size() == vec2.size())
-        {
-            for (uint64_t i = 0; i < vec1.size(); i++)
-            {
-                // for negative numbers, if one of the digit's absolute value
-                // in x is smaller than the corresponding digit's absolute value
-                // in y, then x > y
-                if ((abs)(vec1[i]) < (abs)(vec2[i]))
-                {
-                    return true;
-                }
-            }
-        }
-        return false;
-    }
-    // if x,y are both non-negative
-    else if (vec1[0] >= 0 && vec2[0] >= 0)
-    {
-        // the greater the positive integer's size, the greater its value
-        if (vec1.size() > vec2.size())
-        {
-            return true;
-        }
-        // if both positive integers have the same size
-        else if (vec1.size() == vec2.size())
-        {
-            for (uint64_t i = 0; i < vec1.size(); i++)
-            {
-                // if one of the digit in x is greater
-                // than the corresponding digit in y, then x > y
-                if (vec1[i] > vec2[i])
-                {
-                    return true;
-                }
-            }
-        }
-        return false;
-    }
-    return false;
-}
-
-/**
- * @brief Overloaded binary operator >= to determine if the first
- * infPrecision object is greater than or equal to the second infPrecision object
- *
- * @param _infP1 The first infinite precision integer
- * @param _infP2 The second infinite precision integer
- * @return bool Return true if first infPrecision is greater than or equal to the
- * second infPrecision, false otherwise
- */
-bool operator>=(const infPrecision &_infP1, const infPrecision &_infP2)
-{
-    if (_infP1 > _infP2 || _infP1 == _infP2)
-    {
-        return true;
-    }
-    return false;
-}
-
-/**
- * @brief Overloaded binary operator << to print the
- * integer stored in infPrecision object
- *
- * @param out An ostream object
- * @param _infP A infPrecision object
- * @return ostream& Returns a reference to an ostream object.
- */
-ostream &operator<<(ostream &out, const infPrecision &_infP)
-{
-    vector<int64_t> temp = _infP.get_vec();
-    for (uint64_t i = 0; i < temp.size(); i++)
-        out << temp[i];
-    return out;
-}
\ No newline at end of file
+/**
+ * @file infPrecision.hpp
+ * @author Yiqi Huang (huany132@mcmaster.ca)
+ * @brief Construct a class that allow to store a infinite precision integer
+ * by vector, and overload several basic binary and unary operators of
+ * mathmatical arithmetics and comparison.
+ * @version 0.1
+ * @date 2022-11-27
+ *
+ * @copyright Copyright (c) 2022
+ *
+ */
+
+#ifndef INFPRECISION_HPP
+#define INFPRECISION_HPP
+
+#include <iostream>
+#include <stdexcept>
+#include <vector>
+#include <string>
+#include <algorithm>
+#include <utility>
+#include <cstdint>
+#include <type_traits>
+#include <functional>
+#include <cmath>
+#ifdef INFPRECISION_INSTRUMENT
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#endif
+#ifdef INFPRECISION_SHARED_STORAGE
+#include <atomic>
+#endif
+using namespace std;
+
+// Constructors, basic operators and comparisons are constexpr when the
+// standard library supports std::vector in constant expressions (C++20),
+// and the digits are not in reference counted storage
+#if defined(__cpp_lib_constexpr_vector) && defined(__cpp_lib_constexpr_string) && !defined(INFPRECISION_SHARED_STORAGE)
+#define INFPRECISION_CONSTEXPR constexpr
+#else
+#define INFPRECISION_CONSTEXPR
+#endif
+
+// Small kernels are forced inline into the CPU specific versions compiled
+// for the runtime dispatch, which exists on x86 with GCC or Clang
+#if defined(__GNUC__)
+#define INFPRECISION_ALWAYS_INLINE inline __attribute__((always_inline))
+#else
+#define INFPRECISION_ALWAYS_INLINE inline
+#endif
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define INFPRECISION_X86_DISPATCH
+#endif
+
+// Thresholds measured on the host by the tuning program (tune.cpp), if it
+// has generated infPrecisionTuning.hpp. A threshold defined before including
+// this header still takes precedence.
+#if defined(__has_include)
+#if __has_include("infPrecisionTuning.hpp")
+#include "infPrecisionTuning.hpp"
+#endif
+#endif
+
+// Number of limbs (of 9 digits) from which Karatsuba's method is faster
+// than the schoolbook multiplication
+#ifndef INFPRECISION_KARATSUBA_THRESHOLD
+#define INFPRECISION_KARATSUBA_THRESHOLD 40
+#endif
+
+// Define INFPRECISION_INSTRUMENT to count the calls, operand sizes, time and
+// allocated bytes of the operations, see stats_snapshot(). Without it the
+// instrumentation hooks expand to nothing.
+
+// Define INFPRECISION_SHARED_STORAGE to share the digits of copied objects
+// through an atomically reference counted buffer, which is copied only when
+// one of the owners changes it (copy-on-write). Copies then cost a reference
+// count instead of a copy of the digits, at the price of constexpr support.
+
+// Digit vectors produced by the library are adopted without validation.
+// Define INFPRECISION_CHECK_INVARIANTS (for debug builds) to validate them
+// as strictly as the vectors passed by the user.
+
+namespace infPrecision_detail
+{
+    /**
+     * @brief Get the absolute value of one stored digit, usable in constexpr
+     *
+     */
+    constexpr int64_t abs_digit(int64_t _digit)
+    {
+        return _digit < 0 ? -_digit : _digit;
+    }
+
+    /**
+     * @brief Test if a character is one of '0' ~ '9', usable in constexpr
+     *
+     */
+    constexpr bool is_digit_char(char _c)
+    {
+        return _c >= '0' && _c <= '9';
+    }
+
+    /**
+     * @brief Test if the function is being evaluated in a constant
+     * expression, where the runtime dispatched kernels and the instrumentation
+     * cannot run
+     *
+     */
+    constexpr bool in_constant_evaluation()
+    {
+#ifdef __cpp_lib_is_constant_evaluated
+        return is_constant_evaluated();
+#else
+        return false;
+#endif
+    }
+
+    /**
+     * @brief Tag type selecting the trusted constructor of infPrecision
+     *
+     */
+    struct trusted_t
+    {
+    };
+    constexpr trusted_t trusted{};
+
+#ifdef INFPRECISION_SHARED_STORAGE
+    /**
+     * @brief Digit vector shared by all copies of an integer. The vector is
+     * never changed while it is shared: the owner about to change it gets
+     * its own copy first. The reference count is atomic, so copies can be
+     * handed to other threads freely.
+     *
+     */
+    class shared_digits
+    {
+        struct block
+        {
+            atomic<uint64_t> refs; // number of shared_digits objects referring to the block
+            vector<int64_t> digits;
+
+            block(vector<int64_t> &&_vec) : refs(1), digits(std::move(_vec)) {}
+        };
+        block *data = nullptr;
+
+        /**
+         * @brief Drop the reference to the block, and delete it if it was
+         * the last one. The decrement releases the reads done through this
+         * object, so the owner which finds itself alone afterwards (see
+         * detach) or deletes the block sees all of them finished.
+         *
+         */
+        void release()
+        {
+            if (data && data->refs.fetch_sub(1, memory_order_acq_rel) == 1)
+            {
+                delete data;
+            }
+            data = nullptr;
+        }
+
+    public:
+        shared_digits() {}
+        shared_digits(vector<int64_t> &&_vec) : data(new block(std::move(_vec))) {}
+        shared_digits(const shared_digits &_other) : data(_other.data)
+        {
+            if (data)
+            {
+                // A new reference is made from an existing one, which
+                // already keeps the block alive
+                data->refs.fetch_add(1, memory_order_relaxed);
+            }
+        }
+        shared_digits(shared_digits &&_other) noexcept : data(_other.data)
+        {
+            _other.data = nullptr;
+        }
+        shared_digits &operator=(const shared_digits &_other)
+        {
+            if (data != _other.data)
+            {
+                shared_digits copy(_other);
+                swap(data, copy.data);
+            }
+            return *this;
+        }
+        shared_digits &operator=(shared_digits &&_other) noexcept
+        {
+            if (this != &_other)
+            {
+                release();
+                data = _other.data;
+                _other.data = nullptr;
+            }
+            return *this;
+        }
+        ~shared_digits()
+        {
+            release();
+        }
+
+        /**
+         * @brief Get the digits for reading
+         *
+         */
+        const vector<int64_t> &get() const
+        {
+            return data->digits;
+        }
+
+        /**
+         * @brief Get the digits for writing, copying them first if they are
+         * shared. A count of 1 cannot grow meanwhile, as no other object
+         * refers to the block, and the acquire load synchronizes with the
+         * release decrement of every other object which dropped its
+         * reference, so their last reads happen before the writes here.
+         *
+         */
+        vector<int64_t> &detach()
+        {
+            if (!data)
+            {
+                data = new block(vector<int64_t>());
+            }
+            else if (data->refs.load(memory_order_acquire) != 1)
+            {
+                shared_digits copy(vector<int64_t>(data->digits));
+                swap(data, copy.data);
+            }
+            return data->digits;
+        }
+
+        int64_t operator[](uint64_t _i) const
+        {
+            return data->digits[_i];
+        }
+        uint64_t size() const
+        {
+            return data->digits.size();
+        }
+        uint64_t capacity() const
+        {
+            return data->digits.capacity();
+        }
+        vector<int64_t>::const_iterator begin() const
+        {
+            return data->digits.begin();
+        }
+        vector<int64_t>::const_iterator end() const
+        {
+            return data->digits.end();
+        }
+    };
+    typedef shared_digits digit_storage;
+
+    const vector<int64_t> &read_digits(const shared_digits &_digits)
+    {
+        return _digits.get();
+    }
+
+    vector<int64_t> &write_digits(shared_digits &_digits)
+    {
+        return _digits.detach();
+    }
+#else
+    typedef vector<int64_t> digit_storage;
+
+    /**
+     * @brief Get the digits of an integer for reading
+     *
+     */
+    constexpr const vector<int64_t> &read_digits(const vector<int64_t> &_digits)
+    {
+        return _digits;
+    }
+
+    /**
+     * @brief Get the digits of an integer for writing
+     *
+     */
+    constexpr vector<int64_t> &write_digits(vector<int64_t> &_digits)
+    {
+        return _digits;
+    }
+#endif
+}
+
+#ifdef INFPRECISION_INSTRUMENT
+namespace infPrecision_detail
+{
+    const uint64_t STATS_BUCKETS = 32; // operand sizes of 1, 2-3, 4-7, ... digits
+
+    /**
+     * @brief Operations and multiplication tiers with their own counters
+     *
+     */
+    enum stats_op
+    {
+        STATS_CONSTRUCT,     // construction from a string or a vector
+        STATS_ADD,           // + and everything built on it (-, ++, --)
+        STATS_MUL,           // *
+        STATS_MUL_BASECASE,  // schoolbook tier of the limb multiplication
+        STATS_MUL_KARATSUBA, // Karatsuba tier, including its sub-products
+        STATS_DIVMOD,        // divmod
+        STATS_POWMOD,        // powmod
+        STATS_COMPARE,       // < and >
+        STATS_INSERT,        // insertion into an ostream
+        STATS_TO_LIMBS,      // conversion from digits to base 10^9 limbs
+        STATS_FROM_LIMBS,    // conversion from limbs back to digits
+        STATS_OP_COUNT
+    };
+
+    const char *const STATS_OP_NAMES[STATS_OP_COUNT] = {
+        "construct", "add", "mul", "mul_basecase", "mul_karatsuba", "divmod",
+        "powmod", "compare", "insert", "to_limbs", "from_limbs"};
+}
+
+/**
+ * @brief Snapshot of the instrumentation counters, see stats_snapshot()
+ *
+ */
+struct infPrecision_stats
+{
+    struct op_stats
+    {
+        uint64_t calls = 0;
+        uint64_t nanoseconds = 0;
+        // histogram[b] counts the calls whose larger operand has
+        // 2^b ~ 2^(b+1)-1 digits (the last bucket has all longer ones)
+        uint64_t histogram[infPrecision_detail::STATS_BUCKETS] = {};
+    };
+    op_stats ops[infPrecision_detail::STATS_OP_COUNT];
+    uint64_t bytes_allocated = 0; // bytes of the digit and limb vectors created
+};
+
+namespace infPrecision_detail
+{
+    /**
+     * @brief Counters of one thread. Only the owning thread changes them, by
+     * a relaxed load and store (plain moves, no locked instruction), so a
+     * snapshot can read them from another thread without slowing them down.
+     *
+     */
+    struct thread_stats
+    {
+        atomic<uint64_t> calls[STATS_OP_COUNT];
+        atomic<uint64_t> nanoseconds[STATS_OP_COUNT];
+        atomic<uint64_t> histogram[STATS_OP_COUNT][STATS_BUCKETS];
+        atomic<uint64_t> bytes;
+
+        thread_stats();
+        ~thread_stats();
+    };
+
+    /**
+     * @brief Every live thread_stats, plus the totals of the threads that
+     * have exited and the baseline set by stats_reset()
+     *
+     */
+    struct stats_registry
+    {
+        mutex lock;
+        vector<const thread_stats *> live;
+        infPrecision_stats retired;
+        infPrecision_stats baseline;
+    };
+
+    stats_registry &get_stats_registry()
+    {
+        static stats_registry registry;
+        return registry;
+    }
+
+    /**
+     * @brief Add the counters of one thread into a snapshot
+     *
+     */
+    void add_stats(infPrecision_stats &_total, const thread_stats &_stats)
+    {
+        for (uint64_t op = 0; op < STATS_OP_COUNT; op++)
+        {
+            _total.ops[op].calls += _stats.calls[op].load(memory_order_relaxed);
+            _total.ops[op].nanoseconds += _stats.nanoseconds[op].load(memory_order_relaxed);
+            for (uint64_t b = 0; b < STATS_BUCKETS; b++)
+            {
+                _total.ops[op].histogram[b] += _stats.histogram[op][b].load(memory_order_relaxed);
+            }
+        }
+        _total.bytes_allocated += _stats.bytes.load(memory_order_relaxed);
+    }
+
+    thread_stats::thread_stats()
+    {
+        for (uint64_t op = 0; op < STATS_OP_COUNT; op++)
+        {
+            calls[op].store(0, memory_order_relaxed);
+            nanoseconds[op].store(0, memory_order_relaxed);
+            for (uint64_t b = 0; b < STATS_BUCKETS; b++)
+            {
+                histogram[op][b].store(0, memory_order_relaxed);
+            }
+        }
+        bytes.store(0, memory_order_relaxed);
+        stats_registry &registry = get_stats_registry();
+        lock_guard<mutex> guard(registry.lock);
+        registry.live.push_back(this);
+    }
+
+    thread_stats::~thread_stats()
+    {
+        // Keep the counts of an exiting thread in the totals
+        stats_registry &registry = get_stats_registry();
+        lock_guard<mutex> guard(registry.lock);
+        add_stats(registry.retired, *this);
+        registry.live.erase(find(registry.live.begin(), registry.live.end(), this));
+    }
+
+    thread_stats &local_stats()
+    {
+        static thread_local thread_stats stats;
+        return stats;
+    }
+
+    inline void stats_bump(atomic<uint64_t> &_counter, uint64_t _amount)
+    {
+        _counter.store(_counter.load(memory_order_relaxed) + _amount, memory_order_relaxed);
+    }
+
+    /**
+     * @brief Get the current time for an instrumented operation, 0 in a
+     * constant expression
+     *
+     */
+    INFPRECISION_CONSTEXPR uint64_t stats_clock()
+    {
+        if (in_constant_evaluation())
+        {
+            return 0;
+        }
+        return chrono::duration_cast<chrono::nanoseconds>(chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+    /**
+     * @brief Record one call of an operation which started at _start
+     *
+     * @param _op The operation
+     * @param _digits Digits of the larger operand
+     * @param _start The time from stats_clock() when the operation started
+     */
+    INFPRECISION_CONSTEXPR void stats_record(stats_op _op, uint64_t _digits, uint64_t _start)
+    {
+        if (in_constant_evaluation())
+        {
+            return;
+        }
+        thread_stats &stats = local_stats();
+        uint64_t bucket = 0;
+        while (bucket + 1 < STATS_BUCKETS && (_digits >> (bucket + 1)) > 0)
+        {
+            bucket++;
+        }
+        stats_bump(stats.calls[_op], 1);
+        stats_bump(stats.nanoseconds[_op], stats_clock() - _start);
+        stats_bump(stats.histogram[_op][bucket], 1);
+    }
+
+    /**
+     * @brief Record the bytes of a created digit or limb vector
+     *
+     */
+    INFPRECISION_CONSTEXPR void stats_bytes(uint64_t _bytes)
+    {
+        if (!in_constant_evaluation())
+        {
+            stats_bump(local_stats().bytes, _bytes);
+        }
+    }
+}
+
+/**
+ * @brief Get the instrumentation counters summed over every thread, since
+ * the program started or since the last stats_reset()
+ *
+ * @return infPrecision_stats The counters
+ */
+infPrecision_stats stats_snapshot()
+{
+    using namespace infPrecision_detail;
+    stats_registry &registry = get_stats_registry();
+    lock_guard<mutex> guard(registry.lock);
+    infPrecision_stats total = registry.retired;
+    for (const thread_stats *stats : registry.live)
+    {
+        add_stats(total, *stats);
+    }
+
+    // Counters never decrease, a reset only moves the baseline
+    for (uint64_t op = 0; op < STATS_OP_COUNT; op++)
+    {
+        total.ops[op].calls -= registry.baseline.ops[op].calls;
+        total.ops[op].nanoseconds -= registry.baseline.ops[op].nanoseconds;
+        for (uint64_t b = 0; b < STATS_BUCKETS; b++)
+        {
+            total.ops[op].histogram[b] -= registry.baseline.ops[op].histogram[b];
+        }
+    }
+    total.bytes_allocated -= registry.baseline.bytes_allocated;
+    return total;
+}
+
+/**
+ * @brief Start counting from 0 again, in every thread
+ *
+ */
+void stats_reset()
+{
+    infPrecision_stats current = stats_snapshot();
+    infPrecision_detail::stats_registry &registry = infPrecision_detail::get_stats_registry();
+    lock_guard<mutex> guard(registry.lock);
+    for (uint64_t op = 0; op < infPrecision_detail::STATS_OP_COUNT; op++)
+    {
+        registry.baseline.ops[op].calls += current.ops[op].calls;
+        registry.baseline.ops[op].nanoseconds += current.ops[op].nanoseconds;
+        for (uint64_t b = 0; b < infPrecision_detail::STATS_BUCKETS; b++)
+        {
+            registry.baseline.ops[op].histogram[b] += current.ops[op].histogram[b];
+        }
+    }
+    registry.baseline.bytes_allocated += current.bytes_allocated;
+}
+
+/**
+ * @brief Overloaded binary operator << to export a snapshot of the counters
+ * as JSON. Operations that were never called are left out.
+ *
+ * @param out An ostream object
+ * @param _stats A snapshot from stats_snapshot()
+ * @return ostream& Returns a reference to an ostream object.
+ */
+ostream &operator<<(ostream &out, const infPrecision_stats &_stats)
+{
+    out << "{\"bytes_allocated\": " << _stats.bytes_allocated << ", \"ops\": {";
+    bool first = true;
+    for (uint64_t op = 0; op < infPrecision_detail::STATS_OP_COUNT; op++)
+    {
+        const infPrecision_stats::op_stats &s = _stats.ops[op];
+        if (s.calls == 0)
+        {
+            continue;
+        }
+        out << (first ? "" : ", ") << "\"" << infPrecision_detail::STATS_OP_NAMES[op] << "\": {\"calls\": "
+            << s.calls << ", \"nanoseconds\": " << s.nanoseconds << ", \"digits_histogram\": {";
+        bool first_bucket = true;
+        for (uint64_t b = 0; b < infPrecision_detail::STATS_BUCKETS; b++)
+        {
+            if (s.histogram[b] > 0)
+            {
+                out << (first_bucket ? "" : ", ") << "\"" << (uint64_t(1) << b) << "\": " << s.histogram[b];
+                first_bucket = false;
+            }
+        }
+        out << "}}";
+        first = false;
+    }
+    return out << "}}";
+}
+
+#define INFPRECISION_STATS_BEGIN() const uint64_t infprecision_stats_start = infPrecision_detail::stats_clock()
+#define INFPRECISION_STATS_END(op, digits) infPrecision_detail::stats_record(infPrecision_detail::op, digits, infprecision_stats_start)
+#define INFPRECISION_STATS_BYTES(bytes) infPrecision_detail::stats_bytes(bytes)
+#else
+#define INFPRECISION_STATS_BEGIN()
+#define INFPRECISION_STATS_END(op, digits)
+#define INFPRECISION_STATS_BYTES(bytes)
+#endif
+
+/**
+ * @brief Construct the class of infinite precision integer
+ *
+ */
+class infPrecision
+{
+private:
+    infPrecision_detail::digit_storage integer;
+
+public:
+    /**
+     * @brief Construct a default infPrecision object with integer 0
+     *
+     */
+    INFPRECISION_CONSTEXPR infPrecision()
+    {
+        integer = vector<int64_t>{0};
+    }
+
+    /**
+     * @brief Construct a new infPrecision object by numerical string
+     *
+     * @param _str A numerical string
+     */
+    INFPRECISION_CONSTEXPR infPrecision(const string &_str)
+    {
+        vector<int64_t> &vec = infPrecision_detail::write_digits(integer);
+        INFPRECISION_STATS_BEGIN();
+        // An empty string has no digit
+        if (_str.empty())
+        {
+            throw not_numerical();
+        }
+        // If an integer which is not 0, has leading 0s, throw exception
+        if (_str[0] == '0' && _str.size() > 1)
+        {
+            throw cannot_leadZero();
+        }
+        else if (_str[0] == '-') // If the first character is negative sign
+        {
+            if (infPrecision_detail::is_digit_char(_str[1]))
+            {
+                vec.push_back((_str[1] - '0') * (-1)); // store the first digit as negative number
+            }
+            else
+            {
+                throw not_numerical();
+            }
+            for (uint64_t i = 2; i < _str.size(); i++)
+            {
+                // if all char in string is numerical or the first char is '-'
+                if (infPrecision_detail::is_digit_char(_str[i]))
+                {
+                    vec.push_back(_str[i] - '0'); // store string char by char in integer form
+                }
+                else
+                {
+                    throw not_numerical();
+                }
+            }
+        }
+        else
+        {
+            for (uint64_t i = 0; i < _str.size(); i++)
+            {
+                // If all char in string is numerical or the first char is '-'
+                if (infPrecision_detail::is_digit_char(_str[i]))
+                {
+                    vec.push_back(_str[i] - '0'); // store string char by char in integer form
+                }
+                else
+                {
+                    throw not_numerical();
+                }
+            }
+        }
+        INFPRECISION_STATS_END(STATS_CONSTRUCT, vec.size());
+        INFPRECISION_STATS_BYTES(vec.capacity() * sizeof(int64_t));
+    }
+    /**
+     * @brief Construct a new infPrecision object by 64bit fixed-width signed integer
+     *
+     * @param _64bit A 64bit fixed-width signed integer
+     */
+    INFPRECISION_CONSTEXPR infPrecision(const int64_t &_64bit)
+    {
+        vector<int64_t> &vec = infPrecision_detail::write_digits(integer);
+        // take the absolute value of the input integer, unsigned so that
+        // the smallest int64_t does not overflow
+        uint64_t absolute = _64bit < 0 ? 0 - (uint64_t)_64bit : (uint64_t)_64bit;
+        do
+        {
+            vec.push_back((int64_t)(absolute % 10));
+            absolute /= 10;
+        } while (absolute > 0);
+        reverse(vec.begin(), vec.end());
+        if (_64bit < 0)
+        {
+            vec[0] = vec[0] * -1;
+        }
+    }
+
+    /**
+     * @brief Construct a new infPrecision object by a int64_t type vector
+     *
+     * @param _vec A int64_t type vector
+     */
+    INFPRECISION_CONSTEXPR infPrecision(vector<int64_t> &_vec)
+    {
+        INFPRECISION_STATS_BEGIN();
+        validate(_vec);
+        infPrecision_detail::write_digits(integer) = _vec;
+        INFPRECISION_STATS_END(STATS_CONSTRUCT, integer.size());
+        INFPRECISION_STATS_BYTES(integer.capacity() * sizeof(int64_t));
+    }
+
+    /**
+     * @brief Construct a new infPrecision object by adopting a digit vector
+     * produced by the library. The vector is moved in and not validated
+     * (unless INFPRECISION_CHECK_INVARIANTS is defined), so it must already
+     * have one digit per element, the sign on the first element and no
+     * leading zeros.
+     *
+     * @param _vec A valid int64_t type vector, moved into the object
+     */
+    INFPRECISION_CONSTEXPR infPrecision(infPrecision_detail::trusted_t, vector<int64_t> &&_vec)
+        : integer(std::move(_vec))
+    {
+        INFPRECISION_STATS_BYTES(integer.capacity() * sizeof(int64_t));
+#ifdef INFPRECISION_CHECK_INVARIANTS
+        validate(infPrecision_detail::read_digits(integer));
+#endif
+    }
+
+    /**
+     * @brief Check that a vector holds a valid integer: one digit in every
+     * element, only the first one may be negative, and no leading zeros
+     *
+     * @param _vec A int64_t type vector
+     */
+    static INFPRECISION_CONSTEXPR void validate(const vector<int64_t> &_vec)
+    {
+        // A vector without any digit is not a number
+        if (_vec.empty())
+        {
+            throw not_numerical();
+        }
+        // If an integer which is not 0, has leading 0s, throw exception
+        if (_vec[0] == 0 && _vec.size() > 1)
+        {
+            throw cannot_leadZero();
+        }
+        // The first element holds the sign, it can only have one digit
+        if (infPrecision_detail::abs_digit(_vec[0]) >= 10)
+        {
+            throw cannot_mulDigits();
+        }
+        for (uint64_t i = 1; i < _vec.size(); i++)
+        {
+            // If an integer in the vector other than the first one is
+            // a negative number, throw exception
+            if (_vec[i] < 0)
+            {
+                throw cannot_negative();
+            }
+
+            // If an integer in the vector has two digits, throw exception
+            if (infPrecision_detail::abs_digit(_vec[i]) >= 10)
+            {
+                throw cannot_mulDigits();
+            }
+        }
+    }
+
+    /**
+     * @brief Get the vector of a infPrecision object
+     *
+     */
+    INFPRECISION_CONSTEXPR vector<int64_t> get_vec() const
+    {
+        return infPrecision_detail::read_digits(integer);
+    }
+
+    /**
+     * @brief Get a read-only reference to the vector of a infPrecision
+     * object, without copying it
+     *
+     */
+    INFPRECISION_CONSTEXPR const vector<int64_t> &digits() const
+    {
+        return infPrecision_detail::read_digits(integer);
+    }
+
+    /**
+     * @brief Test if the integer in a infPrecision object is negative
+     *
+     */
+    INFPRECISION_CONSTEXPR bool is_negative() const
+    {
+        if (integer[0] < 0)
+        {
+            return 1; // The integer is negative
+        }
+        return 0;
+    }
+
+    /**
+     * @brief Get the number of decimal digits of the integer, the sign is
+     * not counted and 0 has 1 digit
+     *
+     */
+    INFPRECISION_CONSTEXPR uint64_t num_digits() const
+    {
+        return integer.size(); // every element holds one digit
+    }
+
+    /**
+     * @brief Multiply the integer by 10^_k by appending _k zeros
+     *
+     * @param _k The power of ten
+     * @return infPrecision& The integer after the multiplication
+     */
+    INFPRECISION_CONSTEXPR infPrecision &mul_pow10(uint64_t _k)
+    {
+        vector<int64_t> &vec = infPrecision_detail::write_digits(integer);
+        // 0 stays 0 and must not get leading zeros
+        if (vec[0] != 0)
+        {
+            vec.insert(vec.end(), _k, 0);
+        }
+        return *this;
+    }
+
+    /**
+     * @brief Divide the integer by 10^_k by splitting its digits. The quotient
+     * is truncated toward 0 and the remainder has the same sign as the
+     * integer, the same as divmod().
+     *
+     * @param _k The power of ten
+     * @return pair<infPrecision, infPrecision> The quotient and the remainder
+     */
+    INFPRECISION_CONSTEXPR pair<infPrecision, infPrecision> divmod_pow10(uint64_t _k) const
+    {
+        if (_k >= integer.size())
+        {
+            return make_pair(infPrecision(), *this);
+        }
+        uint64_t split = integer.size() - _k;
+        vector<int64_t> quotient(integer.begin(), integer.begin() + split);
+
+        // Skip the leading zeros of the remainder
+        uint64_t first = split;
+        while (first < integer.size() && integer[first] == 0)
+        {
+            first++;
+        }
+        vector<int64_t> remainder(integer.begin() + first, integer.end());
+        if (remainder.empty())
+        {
+            remainder.push_back(0);
+        }
+        else if (is_negative())
+        {
+            remainder[0] *= (-1);
+        }
+        return make_pair(infPrecision(infPrecision_detail::trusted, std::move(quotient)),
+                         infPrecision(infPrecision_detail::trusted, std::move(remainder)));
+    }
+
+    /**
+     * @brief Keep only the _k most significant digits of the integer, the
+     * dropped digits are truncated toward 0 (123456 becomes 123 with _k = 3)
+     *
+     * @param _k The number of digits to keep
+     * @return infPrecision& The integer after the truncation
+     */
+    INFPRECISION_CONSTEXPR infPrecision &truncate_digits(uint64_t _k)
+    {
+        vector<int64_t> &vec = infPrecision_detail::write_digits(integer);
+        if (_k == 0)
+        {
+            vec = {0};
+        }
+        else if (_k < vec.size())
+        {
+            vec.resize(_k);
+        }
+        return *this;
+    }
+
+    /**
+     * @brief Count the set bits in the absolute value of the integer
+     *
+     */
+    uint64_t popcount() const;
+
+    /**
+     * @brief Get the number of bits needed to store the absolute value of
+     * the integer, 0 has bit length 0
+     *
+     */
+    uint64_t bit_length() const;
+
+    /**
+     * @brief Test one bit of the integer in two's complement form, where a
+     * negative integer has infinitely many leading 1s
+     *
+     * @param _pos Position of the bit, 0 is the least significant bit
+     */
+    bool test_bit(uint64_t _pos) const;
+
+    /**
+     * @brief Set or clear one bit of the integer in two's complement form
+     *
+     * @param _pos Position of the bit, 0 is the least significant bit
+     * @param _value True to set the bit, false to clear it
+     * @return infPrecision& The integer after the bit is changed
+     */
+    infPrecision &set_bit(uint64_t _pos, bool _value = true);
+
+    /**
+     * @brief Overloaded prefix increment for infinite precision integer
+     *
+     * @return infPrecision& InfPrecision object with prefix increment
+     */
+    INFPRECISION_CONSTEXPR infPrecision &operator++()
+    {
+        vector<int64_t> &vec = infPrecision_detail::write_digits(integer);
+        // Reverse the vector for doing iteration easier later
+        reverse(vec.begin(), vec.end());
+        uint64_t s = vec.size(); // size of the vector
+
+        if (vec[s - 1] >= 0) // if the number is non-negative
+        {
+            vec[0] = vec[0] + 1; // Increment the number by 1
+            for (uint64_t i = 0; i < s; i++)
+            {
+                // If the sum caused a digit greater than 10
+                if (vec[i] >= 10)
+                {
+                    vec[i] = vec[i] % 10; // Each element only keep one digit
+                    // If this happens on the first digit,
+                    // add one more digit to hold the incremented 1.
+                    if (i == s - 1)
+                    {
+                        vec.push_back(0);
+                    }
+                    vec[i + 1] += 1; // Next element will also increment by 1
+                }
+            }
+            // reverse the vector back to normal
+            reverse(vec.begin(), vec.end());
+        }
+        // If the number is negative, treat it as a positive number with decrement
+        else if (vec[s - 1] < 0)
+        {
+            // Turn the number to positive
+            vec[s - 1] = vec[s - 1] * (-1);
+            // Decrement the last digit
+            vec[0] = vec[0] - 1;
+
+            for (uint64_t i = 0; i < s; i++)
+            {
+                // If one digit is negative after decrement
+                if (vec[i] < 0)
+                {
+                    vec[i] = 9;      // It will become 9 instead
+                    vec[i + 1] -= 1; // Decrement its next digit
+                }
+            }
+            reverse(vec.begin(), vec.end());
+
+            // Eliminate leading 0s until a non-zero integer, or a single 0 left
+            if (vec.size() > 1)
+            {
+                while (vec[0] == 0)
+                {
+                    vec.erase(vec.begin());
+                }
+            }
+            // Turn the number back to negative
+            vec[0] = vec[0] * (-1);
+        }
+
+        return *this;
+    }
+
+    /**
+     * @brief Overloaded postfix increment for infinite precision integer
+     *
+     * @return infPrecision& InfPrecision object with postfix increment
+     */
+    INFPRECISION_CONSTEXPR infPrecision operator++(int)
+    {
+        infPrecision temp = *this;
+        operator++();
+        return temp;
+    }
+
+    /**
+     * @brief Overloaded prefix decrement for infinite precision integer
+     *
+     * @return infPrecision& InfPrecision object with prefix decrement
+     */
+    INFPRECISION_CONSTEXPR infPrecision &operator--()
+    {
+        vector<int64_t> &vec = infPrecision_detail::write_digits(integer);
+        // Reverse the vector for doing iteration easier later
+        reverse(vec.begin(), vec.end());
+        uint64_t s = vec.size(); // size of the vector
+
+        // If the number is negative, treat it as a positive number with increment
+        if (vec[s - 1] < 0)
+        {
+            // Turn the number to positive
+            vec[s - 1] = vec[s - 1] * (-1);
+            // Decrement of a negative number is plus 1
+            vec[0] = vec[0] + 1;
+            for (uint64_t i = 0; i < s; i++)
+            {
+                // If the sum caused a digit greater than 10
+                if (vec[i] >= 10)
+                {
+                    vec[i] = vec[i] % 10; // Each element only keep one digit
+                    // If this happens on the first digit,
+                    // add one more digit to hold the incremented 1.
+                    if (i == s - 1)
+                    {
+                        vec.push_back(0);
+                    }
+                    vec[i + 1] += 1; // Next element will also increment by 1
+                }
+            }
+            // reverse the vector back to normal
+            reverse(vec.begin(), vec.end());
+            // Turn the number back to negative
+            vec[0] = vec[0] * (-1);
+        }
+        // If the number is non-negative
+        else if (vec[s - 1] >= 0)
+        {
+            // Decrement the last digit
+            vec[0] = vec[0] - 1;
+
+            for (uint64_t i = 0; i < s; i++)
+            {
+                // If there is one digit is negative after decrement and the
+                // number size is greater than 1
+                if (vec[i] < 0 && s > 1)
+                {
+                    vec[i] = 9;      // It will become 9 instead
+                    vec[i + 1] -= 1; // Decrement its next digit
+                }
+                // If the current number is just 0
+                else if (vec[i] < 0 && s == 1)
+                {
+                    vec[i] = -1;
+                }
+            }
+            reverse(vec.begin(), vec.end());
+
+            // Eliminate leading 0s until a non-zero integer, or a single 0 left
+            if (vec.size() > 1)
+            {
+                while (vec[0] == 0)
+                {
+                    vec.erase(vec.begin());
+                }
+            }
+        }
+        return *this;
+    }
+
+    /**
+     * @brief Overloaded postfix decrement for infinite precision integer
+     *
+     * @return infPrecision& InfPrecision object with postfix decrement
+     */
+    INFPRECISION_CONSTEXPR infPrecision operator--(int)
+    {
+        infPrecision temp = *this;
+        operator--();
+        return temp;
+    }
+
+    // Copy constructor, which only shares the digits when
+    // INFPRECISION_SHARED_STORAGE is defined
+    INFPRECISION_CONSTEXPR infPrecision(const infPrecision &_infP)
+        : integer(_infP.integer)
+    {
+    }
+
+    // Move constructor, the moved-from object may only be assigned to or
+    // destroyed
+    INFPRECISION_CONSTEXPR infPrecision(infPrecision &&_infP) noexcept
+        : integer(std::move(_infP.integer))
+    {
+    }
+
+    /**
+     * @brief Overloaded binary operator = to assign one infPrecision object
+     * a new value from another infPrecision
+     *
+     * @param _infP infPrecision object we want to assign from
+     * @return infPrecision& infPrecision object with the new value
+     */
+    INFPRECISION_CONSTEXPR infPrecision &operator=(const infPrecision &_infP)
+    {
+        if (this == &_infP)
+            return *this;
+        integer = _infP.integer;
+        return *this;
+    }
+
+    /**
+     * @brief Overloaded binary operator = to move the value of another
+     * infPrecision object into this one
+     *
+     * @param _infP infPrecision object we want to move from
+     * @return infPrecision& infPrecision object with the new value
+     */
+    INFPRECISION_CONSTEXPR infPrecision &operator=(infPrecision &&_infP) noexcept
+    {
+        if (this == &_infP)
+            return *this;
+        integer = std::move(_infP.integer);
+        return *this;
+    }
+
+    /**
+     * @brief Exception occurs when string in constructor has
+     * non-numerical character
+     *
+     */
+    class not_numerical : public invalid_argument
+    {
+    public:
+        not_numerical() : invalid_argument("Input is not numerical!"){};
+    };
+
+    /**
+     * @brief Exception occurs when vector in constructor has an item (not the
+     * first item) is negative numbers
+     *
+     */
+    class cannot_negative : public invalid_argument
+    {
+    public:
+        cannot_negative() : invalid_argument("Cannot have negative number other than the first item!"){};
+    };
+
+    /**
+     * @brief Exception occurs when vector in constructor has an item is
+     * mult-digits number.
+     *
+     */
+    class cannot_mulDigits : public invalid_argument
+    {
+    public:
+        cannot_mulDigits() : invalid_argument("Cannot have a number more than 1 digit in vector!"){};
+    };
+
+    /**
+     * @brief Exception occurs when vector in constructor or string in
+     * constructor has leading zeros in the front, where the integer is not 0
+     *
+     */
+    class cannot_leadZero : public invalid_argument
+    {
+    public:
+        cannot_leadZero() : invalid_argument("Cannot have leading zeros!"){};
+    };
+
+    /**
+     * @brief Exception occurs when the divisor or modulus of a division
+     * is 0
+     *
+     */
+    class cannot_divideZero : public invalid_argument
+    {
+    public:
+        cannot_divideZero() : invalid_argument("Cannot divide by zero!"){};
+    };
+
+    /**
+     * @brief Exception occurs when the exponent of a power is negative
+     *
+     */
+    class cannot_negExponent : public invalid_argument
+    {
+    public:
+        cannot_negExponent() : invalid_argument("Cannot have a negative exponent!"){};
+    };
+};
+
+// Forward declaration
+INFPRECISION_CONSTEXPR infPrecision operator+(const infPrecision &_infP1, const infPrecision &_infP2);
+INFPRECISION_CONSTEXPR infPrecision operator+=(infPrecision &_infP1, const infPrecision &_infP2);
+INFPRECISION_CONSTEXPR infPrecision operator-(const infPrecision &_infP1, const infPrecision &_infP2);
+INFPRECISION_CONSTEXPR infPrecision operator-=(infPrecision &_infP1, const infPrecision &_infP2);
+INFPRECISION_CONSTEXPR infPrecision operator*(const infPrecision &_infP1, const infPrecision &_infP2);
+INFPRECISION_CONSTEXPR infPrecision operator*=(infPrecision &_infP1, const infPrecision &_infP2);
+INFPRECISION_CONSTEXPR infPrecision operator-(const infPrecision &_infP);
+INFPRECISION_CONSTEXPR bool operator==(const infPrecision &_infP1, const infPrecision &_infP2);
+INFPRECISION_CONSTEXPR bool operator!=(const infPrecision &_infP1, const infPrecision &_infP2);
+INFPRECISION_CONSTEXPR bool operator>(const infPrecision &_infP1, const infPrecision &_infP2);
+INFPRECISION_CONSTEXPR bool operator>=(const infPrecision &_infP1, const infPrecision &_infP2);
+INFPRECISION_CONSTEXPR bool operator<(const infPrecision &_infP1, const infPrecision &_infP2);
+INFPRECISION_CONSTEXPR bool operator<=(const infPrecision &_infP1, const infPrecision &_infP2);
+pair<infPrecision, infPrecision> divmod(const infPrecision &_infP1, const infPrecision &_infP2);
+infPrecision operator<<(const infPrecision &_infP, uint64_t _shift);
+infPrecision operator<<=(infPrecision &_infP, uint64_t _shift);
+infPrecision operator>>(const infPrecision &_infP, uint64_t _shift);
+infPrecision operator>>=(infPrecision &_infP, uint64_t _shift);
+infPrecision operator&(const infPrecision &_infP1, const infPrecision &_infP2);
+infPrecision operator&=(infPrecision &_infP1, const infPrecision &_infP2);
+infPrecision operator|(const infPrecision &_infP1, const infPrecision &_infP2);
+infPrecision operator|=(infPrecision &_infP1, const infPrecision &_infP2);
+infPrecision operator^(const infPrecision &_infP1, const infPrecision &_infP2);
+infPrecision operator^=(infPrecision &_infP1, const infPrecision &_infP2);
+infPrecision operator~(const infPrecision &_infP);
+infPrecision powmod(const infPrecision &_base, const infPrecision &_exp, const infPrecision &_mod);
+ostream &write_integer(ostream &_out, const infPrecision &_infP, uint64_t _block = 65536);
+infPrecision read_integer(istream &_in);
+istream &operator>>(istream &in, infPrecision &_infP);
+
+/**
+ * @brief Kernels working on the stored decimal digits directly. The digit
+ * arrays are magnitudes stored from the most significant digit, the same
+ * order as the vector in infPrecision. The carries (and borrows) are resolved
+ * 64 digits at a time by carry-lookahead: every digit is added independently,
+ * which the compiler vectorizes, and the carries of a whole block are found
+ * by one 64-bit addition of the generate and propagate masks.
+ *
+ */
+namespace infPrecision_detail
+{
+    const uint64_t KERNEL_BLOCK = 64; // digits handled by one carry mask
+
+    /**
+     * @brief Add the last _m digits of two magnitudes with carry-lookahead
+     *
+     * @param _a Points to the least significant digit of the first magnitude
+     * @param _b Points to the least significant digit of the second magnitude
+     * @param _out Points to the least significant digit of the result
+     * @param _m Number of digits to add
+     * @return int64_t The carry out of the most significant digit
+     */
+    INFPRECISION_CONSTEXPR INFPRECISION_ALWAYS_INLINE int64_t add_digits_lookahead(
+        const int64_t *_a, const int64_t *_b, int64_t *_out, uint64_t _m)
+    {
+        uint64_t carry = 0;
+        for (uint64_t lo = 0; lo < _m; lo += KERNEL_BLOCK)
+        {
+            uint64_t w = min(KERNEL_BLOCK, _m - lo);
+            uint64_t generate = 0;  // digits whose sum is at least 10
+            uint64_t propagate = 0; // digits whose sum is 9
+            for (uint64_t j = 0; j < w; j++)
+            {
+                int64_t s = _a[-(int64_t)(lo + j)] + _b[-(int64_t)(lo + j)];
+                _out[-(int64_t)(lo + j)] = s;
+                generate |= (uint64_t)(s >= 10) << j;
+                propagate |= (uint64_t)(s == 9) << j;
+            }
+            // carries[j] is the carry into digit j of this block
+            uint64_t carries = (((generate << 1) | carry) + propagate) ^ propagate;
+            carry = ((generate | (propagate & carries)) >> (w - 1)) & 1;
+            for (uint64_t j = 0; j < w; j++)
+            {
+                int64_t s = _out[-(int64_t)(lo + j)] + (int64_t)((carries >> j) & 1);
+                _out[-(int64_t)(lo + j)] = s - 10 * (s >= 10);
+            }
+        }
+        return carry;
+    }
+
+    /**
+     * @brief Subtract the last _m digits of two magnitudes with
+     * borrow-lookahead
+     *
+     * @param _a Points to the least significant digit of the first magnitude
+     * @param _b Points to the least significant digit of the second magnitude
+     * @param _out Points to the least significant digit of the result
+     * @param _m Number of digits to subtract
+     * @return int64_t The borrow out of the most significant digit
+     */
+    INFPRECISION_CONSTEXPR INFPRECISION_ALWAYS_INLINE int64_t sub_digits_lookahead(
+        const int64_t *_a, const int64_t *_b, int64_t *_out, uint64_t _m)
+    {
+        uint64_t borrow = 0;
+        for (uint64_t lo = 0; lo < _m; lo += KERNEL_BLOCK)
+        {
+            uint64_t w = min(KERNEL_BLOCK, _m - lo);
+            uint64_t generate = 0;  // digits whose difference is negative
+            uint64_t propagate = 0; // digits whose difference is 0
+            for (uint64_t j = 0; j < w; j++)
+            {
+                int64_t d = _a[-(int64_t)(lo + j)] - _b[-(int64_t)(lo + j)];
+                _out[-(int64_t)(lo + j)] = d;
+                generate |= (uint64_t)(d < 0) << j;
+                propagate |= (uint64_t)(d == 0) << j;
+            }
+            // borrows[j] is the borrow into digit j of this block
+            uint64_t borrows = (((generate << 1) | borrow) + propagate) ^ propagate;
+            borrow = ((generate | (propagate & borrows)) >> (w - 1)) & 1;
+            for (uint64_t j = 0; j < w; j++)
+            {
+                int64_t d = _out[-(int64_t)(lo + j)] - (int64_t)((borrows >> j) & 1);
+                _out[-(int64_t)(lo + j)] = d + 10 * (d < 0);
+            }
+        }
+        return borrow;
+    }
+
+    /**
+     * @brief Compare two digit arrays of the same length
+     *
+     * @return int Return -1, 0 or 1 if the first array is smaller than,
+     * equal to or greater than the second array
+     */
+    INFPRECISION_CONSTEXPR INFPRECISION_ALWAYS_INLINE int compare_digits_blocked(
+        const int64_t *_a, const int64_t *_b, uint64_t _n)
+    {
+        for (uint64_t lo = 0; lo < _n; lo += KERNEL_BLOCK)
+        {
+            // Look for a difference in the whole block without branching
+            uint64_t w = min(KERNEL_BLOCK, _n - lo);
+            int64_t diff = 0;
+            for (uint64_t j = 0; j < w; j++)
+            {
+                diff |= _a[lo + j] ^ _b[lo + j];
+            }
+            if (diff == 0)
+            {
+                continue;
+            }
+            for (uint64_t j = 0; j < w; j++)
+            {
+                if (_a[lo + j] != _b[lo + j])
+                {
+                    return _a[lo + j] < _b[lo + j] ? -1 : 1;
+                }
+            }
+        }
+        return 0;
+    }
+
+    typedef int64_t (*carry_kernel)(const int64_t *, const int64_t *, int64_t *, uint64_t);
+    typedef int (*compare_kernel)(const int64_t *, const int64_t *, uint64_t);
+
+    /**
+     * @brief The digit kernels picked for the running CPU
+     *
+     */
+    struct digit_kernels
+    {
+        carry_kernel add;
+        carry_kernel sub;
+        compare_kernel compare;
+    };
+
+    int64_t add_digits_scalar(const int64_t *_a, const int64_t *_b, int64_t *_out, uint64_t _m)
+    {
+        return add_digits_lookahead(_a, _b, _out, _m);
+    }
+    int64_t sub_digits_scalar(const int64_t *_a, const int64_t *_b, int64_t *_out, uint64_t _m)
+    {
+        return sub_digits_lookahead(_a, _b, _out, _m);
+    }
+    int compare_digits_scalar(const int64_t *_a, const int64_t *_b, uint64_t _n)
+    {
+        return compare_digits_blocked(_a, _b, _n);
+    }
+
+#ifdef INFPRECISION_X86_DISPATCH
+    // The same kernels compiled for AVX2 and AVX-512
+    __attribute__((target("avx2"))) int64_t add_digits_avx2(const int64_t *_a, const int64_t *_b, int64_t *_out, uint64_t _m)
+    {
+        return add_digits_lookahead(_a, _b, _out, _m);
+    }
+    __attribute__((target("avx2"))) int64_t sub_digits_avx2(const int64_t *_a, const int64_t *_b, int64_t *_out, uint64_t _m)
+    {
+        return sub_digits_lookahead(_a, _b, _out, _m);
+    }
+    __attribute__((target("avx2"))) int compare_digits_avx2(const int64_t *_a, const int64_t *_b, uint64_t _n)
+    {
+        return compare_digits_blocked(_a, _b, _n);
+    }
+    __attribute__((target("avx512f,avx512bw"))) int64_t add_digits_avx512(const int64_t *_a, const int64_t *_b, int64_t *_out, uint64_t _m)
+    {
+        return add_digits_lookahead(_a, _b, _out, _m);
+    }
+    __attribute__((target("avx512f,avx512bw"))) int64_t sub_digits_avx512(const int64_t *_a, const int64_t *_b, int64_t *_out, uint64_t _m)
+    {
+        return sub_digits_lookahead(_a, _b, _out, _m);
+    }
+    __attribute__((target("avx512f,avx512bw"))) int compare_digits_avx512(const int64_t *_a, const int64_t *_b, uint64_t _n)
+    {
+        return compare_digits_blocked(_a, _b, _n);
+    }
+#endif
+
+    /**
+     * @brief Get the digit kernels for the running CPU. The CPU is detected
+     * once, the first time a kernel is needed.
+     *
+     */
+    const digit_kernels &get_digit_kernels()
+    {
+        static const digit_kernels kernels = []()
+        {
+#ifdef INFPRECISION_X86_DISPATCH
+            if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw"))
+            {
+                return digit_kernels{add_digits_avx512, sub_digits_avx512, compare_digits_avx512};
+            }
+            if (__builtin_cpu_supports("avx2"))
+            {
+                return digit_kernels{add_digits_avx2, sub_digits_avx2, compare_digits_avx2};
+            }
+#endif
+            return digit_kernels{add_digits_scalar, sub_digits_scalar, compare_digits_scalar};
+        }();
+        return kernels;
+    }
+
+    /**
+     * @brief Add two magnitudes stored from the most significant digit
+     *
+     * @param _a The longer magnitude, _n digits
+     * @param _b The shorter magnitude, _m <= _n digits
+     * @param _out The result, _n + 1 digits, _out[0] is the final carry
+     */
+    INFPRECISION_CONSTEXPR void add_digits(const int64_t *_a, uint64_t _n, const int64_t *_b, uint64_t _m, int64_t *_out)
+    {
+        const int64_t *a = _a + _n - 1, *b = _b + _m - 1;
+        int64_t *out = _out + _n;
+        int64_t carry = in_constant_evaluation() ? add_digits_lookahead(a, b, out, _m)
+                                                 : get_digit_kernels().add(a, b, out, _m);
+        // The rest of the longer magnitude only takes the carry
+        for (uint64_t k = _m; k < _n; k++)
+        {
+            int64_t s = a[-(int64_t)k] + carry;
+            carry = s >= 10;
+            out[-(int64_t)k] = s - 10 * carry;
+        }
+        _out[0] = carry;
+    }
+
+    /**
+     * @brief Subtract two magnitudes stored from the most significant digit,
+     * the first magnitude must not be smaller than the second one
+     *
+     * @param _a The greater magnitude, _n digits
+     * @param _b The smaller magnitude, _m <= _n digits
+     * @param _out The result, _n digits, may have leading zeros
+     */
+    INFPRECISION_CONSTEXPR void sub_digits(const int64_t *_a, uint64_t _n, const int64_t *_b, uint64_t _m, int64_t *_out)
+    {
+        const int64_t *a = _a + _n - 1, *b = _b + _m - 1;
+        int64_t *out = _out + _n - 1;
+        int64_t borrow = in_constant_evaluation() ? sub_digits_lookahead(a, b, out, _m)
+                                                  : get_digit_kernels().sub(a, b, out, _m);
+        // The rest of the greater magnitude only gives the borrow
+        for (uint64_t k = _m; k < _n; k++)
+        {
+            int64_t d = a[-(int64_t)k] - borrow;
+            borrow = d < 0;
+            out[-(int64_t)k] = d + 10 * borrow;
+        }
+    }
+
+    /**
+     * @brief Compare two magnitudes stored from the most significant digit
+     *
+     * @return int Return -1, 0 or 1 if the first magnitude is smaller than,
+     * equal to or greater than the second magnitude
+     */
+    INFPRECISION_CONSTEXPR int compare_digits(const int64_t *_a, uint64_t _n, const int64_t *_b, uint64_t _m)
+    {
+        if (_n != _m)
+        {
+            return _n < _m ? -1 : 1;
+        }
+        return in_constant_evaluation() ? compare_digits_blocked(_a, _b, _n)
+                                        : get_digit_kernels().compare(_a, _b, _n);
+    }
+
+    /**
+     * @brief Compare the absolute values of two infPrecision objects
+     *
+     * @return int Return -1, 0 or 1 if |_infP1| is smaller than, equal to
+     * or greater than |_infP2|
+     */
+    INFPRECISION_CONSTEXPR int compare_magnitude(const vector<int64_t> &_vec1, const vector<int64_t> &_vec2)
+    {
+        if (_vec1.size() != _vec2.size())
+        {
+            return _vec1.size() < _vec2.size() ? -1 : 1;
+        }
+        // Only the first digit holds the sign
+        int64_t first1 = abs_digit(_vec1[0]), first2 = abs_digit(_vec2[0]);
+        if (first1 != first2)
+        {
+            return first1 < first2 ? -1 : 1;
+        }
+        return compare_digits(_vec1.data() + 1, _vec1.size() - 1, _vec2.data() + 1, _vec2.size() - 1);
+    }
+
+    /**
+     * @brief Rotate a 64-bit word left by _r bits, 0 < _r < 64
+     *
+     */
+    constexpr uint64_t rotl64(uint64_t _x, int _r)
+    {
+        return (_x << _r) | (_x >> (64 - _r));
+    }
+
+    /**
+     * @brief Hash a digit array straight from memory. Four lanes consume
+     * four consecutive digits independently, so the multiplications overlap
+     * (and vectorize where 64-bit multiplies exist); the lanes are merged by
+     * the finalizer of MurmurHash3, which spreads every input bit.
+     *
+     * @param _digits The stored digits, the first one may carry the sign
+     * @param _n The number of digits
+     * @return uint64_t The hash
+     */
+    INFPRECISION_CONSTEXPR uint64_t hash_digits(const int64_t *_digits, uint64_t _n)
+    {
+        const uint64_t MULTIPLIER = 0x9E3779B97F4A7C15ULL;
+        // Separate variables rather than an array, so the lanes stay in
+        // registers
+        uint64_t lane0 = 0x243F6A8885A308D3ULL, lane1 = 0x13198A2E03707344ULL;
+        uint64_t lane2 = 0xA4093822299F31D0ULL, lane3 = 0x082EFA98EC4E6C89ULL;
+        uint64_t i = 0;
+        for (; i + 4 <= _n; i += 4)
+        {
+            lane0 = (lane0 ^ (uint64_t)_digits[i]) * MULTIPLIER;
+            lane1 = (lane1 ^ (uint64_t)_digits[i + 1]) * MULTIPLIER;
+            lane2 = (lane2 ^ (uint64_t)_digits[i + 2]) * MULTIPLIER;
+            lane3 = (lane3 ^ (uint64_t)_digits[i + 3]) * MULTIPLIER;
+        }
+        // The last 0 to 3 digits go to the first lanes
+        if (i < _n)
+        {
+            lane0 = (lane0 ^ (uint64_t)_digits[i++]) * MULTIPLIER;
+        }
+        if (i < _n)
+        {
+            lane1 = (lane1 ^ (uint64_t)_digits[i++]) * MULTIPLIER;
+        }
+        if (i < _n)
+        {
+            lane2 = (lane2 ^ (uint64_t)_digits[i++]) * MULTIPLIER;
+        }
+        uint64_t h = _n ^ lane0 ^ rotl64(lane1, 16) ^ rotl64(lane2, 32) ^ rotl64(lane3, 48);
+        h ^= h >> 33;
+        h *= 0xFF51AFD7ED558CCDULL;
+        h ^= h >> 33;
+        h *= 0xC4CEB9FE1A85EC53ULL;
+        h ^= h >> 33;
+        return h;
+    }
+}
+
+/**
+ * @brief Helpers working on the magnitude of an integer packed into
+ * base 10^9 limbs. Limbs are stored from the least significant to the most
+ * significant, so nine decimal digits are handled by one machine operation.
+ * Every result is stripped from leading zero limbs, and 0 is stored as {0}.
+ *
+ */
+namespace infPrecision_detail
+{
+    const uint64_t LIMB_BASE = 1000000000; // 10^9
+    const uint64_t LIMB_DIGITS = 9;        // decimal digits in one limb
+
+    /**
+     * @brief Remove leading zero limbs, keep a single 0 limb for integer 0
+     *
+     * @param _limbs Limbs to be trimmed
+     */
+    INFPRECISION_CONSTEXPR void trim_limbs(vector<uint32_t> &_limbs)
+    {
+        while (_limbs.size() > 1 && _limbs.back() == 0)
+        {
+            _limbs.pop_back();
+        }
+        if (_limbs.empty())
+        {
+            _limbs.push_back(0);
+        }
+    }
+
+    /**
+     * @brief Pack the absolute value of a infPrecision object into limbs
+     *
+     * @param _infP A infPrecision object
+     * @return vector<uint32_t> Limbs of the magnitude
+     */
+    INFPRECISION_CONSTEXPR vector<uint32_t> to_limbs(const infPrecision &_infP)
+    {
+        INFPRECISION_STATS_BEGIN();
+        vector<int64_t> vec = _infP.get_vec();
+        vector<uint32_t> limbs;
+        limbs.reserve(vec.size() / LIMB_DIGITS + 1);
+
+        // Take groups of nine digits from the right to the left
+        int64_t end = vec.size();
+        while (end > 0)
+        {
+            int64_t begin = max<int64_t>(0, end - LIMB_DIGITS);
+            uint32_t limb = 0;
+            for (int64_t i = begin; i < end; i++)
+            {
+                limb = limb * 10 + abs_digit(vec[i]);
+            }
+            limbs.push_back(limb);
+            end = begin;
+        }
+        trim_limbs(limbs);
+        INFPRECISION_STATS_END(STATS_TO_LIMBS, vec.size());
+        INFPRECISION_STATS_BYTES(limbs.capacity() * sizeof(uint32_t));
+        return limbs;
+    }
+
+    /**
+     * @brief Unpack limbs back into a infPrecision object
+     *
+     * @param _limbs Limbs of the magnitude
+     * @param _negative True if the integer should be negative
+     * @return infPrecision The integer stored in the limbs
+     */
+    INFPRECISION_CONSTEXPR infPrecision from_limbs(const vector<uint32_t> &_limbs, bool _negative)
+    {
+        INFPRECISION_STATS_BEGIN();
+        vector<int64_t> vec;
+        vec.reserve(_limbs.size() * LIMB_DIGITS);
+        for (uint64_t i = _limbs.size(); i-- > 0;)
+        {
+            uint32_t limb = _limbs[i];
+            int64_t digits[LIMB_DIGITS] = {};
+            for (uint64_t j = LIMB_DIGITS; j-- > 0;)
+            {
+                digits[j] = limb % 10;
+                limb /= 10;
+            }
+            for (uint64_t j = 0; j < LIMB_DIGITS; j++)
+            {
+                // The most significant limb has no leading zeros
+                if (vec.empty() && digits[j] == 0)
+                {
+                    continue;
+                }
+                vec.push_back(digits[j]);
+            }
+        }
+        if (vec.empty())
+        {
+            vec.push_back(0);
+        }
+        else if (_negative)
+        {
+            vec[0] *= (-1);
+        }
+        INFPRECISION_STATS_END(STATS_FROM_LIMBS, vec.size());
+        return infPrecision(trusted, std::move(vec));
+    }
+
+    /**
+     * @brief Test if the limbs hold integer 0
+     *
+     */
+    INFPRECISION_CONSTEXPR bool is_zero_limbs(const vector<uint32_t> &_limbs)
+    {
+        return _limbs.size() == 1 && _limbs[0] == 0;
+    }
+
+    /**
+     * @brief Compare two magnitudes
+     *
+     * @return int Return -1, 0 or 1 if the first magnitude is smaller than,
+     * equal to or greater than the second magnitude
+     */
+    int compare_limbs(const vector<uint32_t> &_a, const vector<uint32_t> &_b)
+    {
+        if (_a.size() != _b.size())
+        {
+            return _a.size() < _b.size() ? -1 : 1;
+        }
+        for (uint64_t i = _a.size(); i-- > 0;)
+        {
+            if (_a[i] != _b[i])
+            {
+                return _a[i] < _b[i] ? -1 : 1;
+            }
+        }
+        return 0;
+    }
+
+    /**
+     * @brief Add two magnitudes
+     *
+     */
+    INFPRECISION_CONSTEXPR vector<uint32_t> add_limbs(const vector<uint32_t> &_a, const vector<uint32_t> &_b)
+    {
+        const vector<uint32_t> &longer = _a.size() >= _b.size() ? _a : _b;
+        const vector<uint32_t> &shorter = _a.size() >= _b.size() ? _b : _a;
+        vector<uint32_t> sum(longer.size() + 1, 0);
+        uint64_t carry = 0;
+        for (uint64_t i = 0; i < longer.size(); i++)
+        {
+            uint64_t cur = longer[i] + carry + (i < shorter.size() ? shorter[i] : 0);
+            carry = cur >= LIMB_BASE;
+            sum[i] = cur - carry * LIMB_BASE;
+        }
+        sum[longer.size()] = carry;
+        trim_limbs(sum);
+        return sum;
+    }
+
+    /**
+     * @brief Subtract the second magnitude from the first magnitude, where
+     * the first magnitude must not be smaller than the second one
+     *
+     */
+    INFPRECISION_CONSTEXPR vector<uint32_t> sub_limbs(const vector<uint32_t> &_a, const vector<uint32_t> &_b)
+    {
+        vector<uint32_t> diff(_a.size(), 0);
+        int64_t borrow = 0;
+        for (uint64_t i = 0; i < _a.size(); i++)
+        {
+            int64_t cur = (int64_t)_a[i] - borrow - (i < _b.size() ? _b[i] : 0);
+            borrow = cur < 0;
+            diff[i] = cur + borrow * LIMB_BASE;
+        }
+        trim_limbs(diff);
+        return diff;
+    }
+
+    /**
+     * @brief Multiply _n limbs by one limb, r = a * b
+     *
+     * @return uint32_t The carry limb out of the top
+     */
+    INFPRECISION_CONSTEXPR INFPRECISION_ALWAYS_INLINE uint32_t mul_1_generic(
+        uint32_t *_r, const uint32_t *_a, uint64_t _n, uint32_t _b)
+    {
+        uint64_t carry = 0;
+        for (uint64_t i = 0; i < _n; i++)
+        {
+            uint64_t cur = (uint64_t)_a[i] * _b + carry;
+            _r[i] = cur % LIMB_BASE;
+            carry = cur / LIMB_BASE;
+        }
+        return carry;
+    }
+
+    /**
+     * @brief Multiply _n limbs by one limb and add the product, r += a * b
+     *
+     * @return uint32_t The carry limb out of the top
+     */
+    INFPRECISION_CONSTEXPR INFPRECISION_ALWAYS_INLINE uint32_t addmul_1_generic(
+        uint32_t *_r, const uint32_t *_a, uint64_t _n, uint32_t _b)
+    {
+        uint64_t carry = 0;
+        for (uint64_t i = 0; i < _n; i++)
+        {
+            // At most (10^9 - 1)^2 + 2 * (10^9 - 1), which fits in 64 bits
+            uint64_t cur = _r[i] + (uint64_t)_a[i] * _b + carry;
+            _r[i] = cur % LIMB_BASE;
+            carry = cur / LIMB_BASE;
+        }
+        return carry;
+    }
+
+    /**
+     * @brief Multiply _n limbs by one limb and subtract the product,
+     * r -= a * b
+     *
+     * @return uint32_t The borrow limb out of the top
+     */
+    INFPRECISION_CONSTEXPR INFPRECISION_ALWAYS_INLINE uint32_t submul_1_generic(
+        uint32_t *_r, const uint32_t *_a, uint64_t _n, uint32_t _b)
+    {
+        uint64_t carry = 0;
+        for (uint64_t i = 0; i < _n; i++)
+        {
+            uint64_t p = (uint64_t)_a[i] * _b + carry;
+            carry = p / LIMB_BASE;
+            int64_t cur = (int64_t)_r[i] - (int64_t)(p % LIMB_BASE);
+            int64_t borrow = cur < 0;
+            _r[i] = cur + borrow * LIMB_BASE;
+            carry += borrow;
+        }
+        return carry;
+    }
+
+    /**
+     * @brief Multiply _n limbs by one limb and add the products to 64-bit
+     * accumulators without carrying, acc += a * b. Each product is below
+     * 10^18, so an accumulator holds 18 products before it must be carried.
+     * The loop has no dependency between limbs, so the compiler vectorizes it.
+     *
+     */
+    INFPRECISION_CONSTEXPR INFPRECISION_ALWAYS_INLINE void addmul_1_lazy_generic(
+        uint64_t *_acc, const uint32_t *_a, uint64_t _n, uint32_t _b)
+    {
+        for (uint64_t i = 0; i < _n; i++)
+        {
+            _acc[i] += (uint64_t)_a[i] * _b;
+        }
+    }
+
+    typedef uint32_t (*mul_1_kernel)(uint32_t *, const uint32_t *, uint64_t, uint32_t);
+    typedef void (*lazy_kernel)(uint64_t *, const uint32_t *, uint64_t, uint32_t);
+
+    /**
+     * @brief The limb kernels picked for the running CPU
+     *
+     */
+    struct limb_kernels
+    {
+        mul_1_kernel mul_1;
+        mul_1_kernel addmul_1;
+        mul_1_kernel submul_1;
+        lazy_kernel addmul_1_lazy;
+    };
+
+    uint32_t mul_1_scalar(uint32_t *_r, const uint32_t *_a, uint64_t _n, uint32_t _b)
+    {
+        return mul_1_generic(_r, _a, _n, _b);
+    }
+    uint32_t addmul_1_scalar(uint32_t *_r, const uint32_t *_a, uint64_t _n, uint32_t _b)
+    {
+        return addmul_1_generic(_r, _a, _n, _b);
+    }
+    uint32_t submul_1_scalar(uint32_t *_r, const uint32_t *_a, uint64_t _n, uint32_t _b)
+    {
+        return submul_1_generic(_r, _a, _n, _b);
+    }
+    void addmul_1_lazy_scalar(uint64_t *_acc, const uint32_t *_a, uint64_t _n, uint32_t _b)
+    {
+        addmul_1_lazy_generic(_acc, _a, _n, _b);
+    }
+
+#ifdef INFPRECISION_X86_DISPATCH
+    // The same kernels compiled with MULX (BMI2) for the divisions by 10^9,
+    // and with AVX2 or AVX-512 for the lazy accumulation
+    __attribute__((target("avx2,bmi2"))) uint32_t mul_1_avx2(uint32_t *_r, const uint32_t *_a, uint64_t _n, uint32_t _b)
+    {
+        return mul_1_generic(_r, _a, _n, _b);
+    }
+    __attribute__((target("avx2,bmi2"))) uint32_t addmul_1_avx2(uint32_t *_r, const uint32_t *_a, uint64_t _n, uint32_t _b)
+    {
+        return addmul_1_generic(_r, _a, _n, _b);
+    }
+    __attribute__((target("avx2,bmi2"))) uint32_t submul_1_avx2(uint32_t *_r, const uint32_t *_a, uint64_t _n, uint32_t _b)
+    {
+        return submul_1_generic(_r, _a, _n, _b);
+    }
+    __attribute__((target("avx2,bmi2"))) void addmul_1_lazy_avx2(uint64_t *_acc, const uint32_t *_a, uint64_t _n, uint32_t _b)
+    {
+        addmul_1_lazy_generic(_acc, _a, _n, _b);
+    }
+    __attribute__((target("avx512f,avx512bw,bmi2"))) void addmul_1_lazy_avx512(uint64_t *_acc, const uint32_t *_a, uint64_t _n, uint32_t _b)
+    {
+        addmul_1_lazy_generic(_acc, _a, _n, _b);
+    }
+#endif
+
+    /**
+     * @brief Get the limb kernels for the running CPU. The CPU is detected
+     * once, the first time a kernel is needed.
+     *
+     */
+    const limb_kernels &get_limb_kernels()
+    {
+        static const limb_kernels kernels = []()
+        {
+#ifdef INFPRECISION_X86_DISPATCH
+            if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("bmi2"))
+            {
+                bool avx512 = __builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw");
+                return limb_kernels{mul_1_avx2, addmul_1_avx2, submul_1_avx2,
+                                    avx512 ? addmul_1_lazy_avx512 : addmul_1_lazy_avx2};
+            }
+#endif
+            return limb_kernels{mul_1_scalar, addmul_1_scalar, submul_1_scalar, addmul_1_lazy_scalar};
+        }();
+        return kernels;
+    }
+
+    /**
+     * @brief Dispatched r = a * b on _n limbs, see mul_1_generic
+     *
+     */
+    INFPRECISION_CONSTEXPR uint32_t mul_1(uint32_t *_r, const uint32_t *_a, uint64_t _n, uint32_t _b)
+    {
+        return in_constant_evaluation() ? mul_1_generic(_r, _a, _n, _b) : get_limb_kernels().mul_1(_r, _a, _n, _b);
+    }
+
+    /**
+     * @brief Dispatched r += a * b on _n limbs, see addmul_1_generic
+     *
+     */
+    INFPRECISION_CONSTEXPR uint32_t addmul_1(uint32_t *_r, const uint32_t *_a, uint64_t _n, uint32_t _b)
+    {
+        return in_constant_evaluation() ? addmul_1_generic(_r, _a, _n, _b) : get_limb_kernels().addmul_1(_r, _a, _n, _b);
+    }
+
+    /**
+     * @brief Dispatched r -= a * b on _n limbs, see submul_1_generic
+     *
+     */
+    INFPRECISION_CONSTEXPR uint32_t submul_1(uint32_t *_r, const uint32_t *_a, uint64_t _n, uint32_t _b)
+    {
+        return in_constant_evaluation() ? submul_1_generic(_r, _a, _n, _b) : get_limb_kernels().submul_1(_r, _a, _n, _b);
+    }
+
+    /**
+     * @brief Carry the accumulators in [_lo, _size) down to single limbs.
+     * Every accumulator is below 2^64, so the carries fit in 64 bits.
+     *
+     */
+    INFPRECISION_CONSTEXPR void carry_accumulators(uint64_t *_acc, uint64_t _lo, uint64_t _size)
+    {
+        uint64_t carry = 0;
+        for (uint64_t i = _lo; i < _size; i++)
+        {
+            uint64_t cur = _acc[i] + carry;
+            _acc[i] = cur % LIMB_BASE;
+            carry = cur / LIMB_BASE;
+        }
+    }
+
+    /**
+     * @brief Multiply two magnitudes by the schoolbook method, the basecase of
+     * every multiplication. The rows are accumulated without carrying, and the
+     * accumulators are carried once every 18 rows.
+     *
+     * @param _r The product, _n + _m limbs
+     * @param _a The first magnitude, _n limbs
+     * @param _b The second magnitude, _m limbs
+     */
+    INFPRECISION_CONSTEXPR void mul_basecase(uint32_t *_r, const uint32_t *_a, uint64_t _n,
+                                             const uint32_t *_b, uint64_t _m)
+    {
+        INFPRECISION_STATS_BEGIN();
+        // (10^9 - 1) + 18 * (10^9 - 1)^2 < 2^64
+        const uint64_t ROWS_PER_CARRY = 18;
+        vector<uint64_t> acc(_n + _m, 0);
+        uint64_t first_row = 0; // first row not carried yet
+        for (uint64_t j = 0; j < _m; j++)
+        {
+            if (_b[j] != 0)
+            {
+                if (in_constant_evaluation())
+                {
+                    addmul_1_lazy_generic(acc.data() + j, _a, _n, _b[j]);
+                }
+                else
+                {
+                    get_limb_kernels().addmul_1_lazy(acc.data() + j, _a, _n, _b[j]);
+                }
+            }
+            if (j + 1 - first_row == ROWS_PER_CARRY)
+            {
+                carry_accumulators(acc.data(), first_row, _n + _m);
+                first_row = j + 1;
+            }
+        }
+        carry_accumulators(acc.data(), first_row, _n + _m);
+        for (uint64_t i = 0; i < _n + _m; i++)
+        {
+            _r[i] = acc[i];
+        }
+        INFPRECISION_STATS_END(STATS_MUL_BASECASE, max(_n, _m) * LIMB_DIGITS);
+    }
+
+    /**
+     * @brief Multiply two magnitudes, by the schoolbook basecase for short
+     * operands and by Karatsuba's method above the threshold. A much longer
+     * operand is cut into pieces as long as the shorter one, so both operands
+     * of every Karatsuba step have similar sizes.
+     *
+     * @param _a The first magnitude
+     * @param _b The second magnitude
+     * @param _threshold Limbs of the shorter operand from which Karatsuba's
+     * method is used, only changed by the tuning program
+     * @return vector<uint32_t> The product
+     */
+    INFPRECISION_CONSTEXPR vector<uint32_t> mul_limbs(const vector<uint32_t> &_a, const vector<uint32_t> &_b,
+                                                      uint64_t _threshold = INFPRECISION_KARATSUBA_THRESHOLD)
+    {
+        INFPRECISION_STATS_BEGIN();
+        const vector<uint32_t> &longer = _a.size() >= _b.size() ? _a : _b;
+        const vector<uint32_t> &shorter = _a.size() >= _b.size() ? _b : _a;
+        uint64_t n = longer.size(), m = shorter.size();
+
+        vector<uint32_t> product(n + m, 0);
+        if (m < _threshold)
+        {
+            mul_basecase(product.data(), longer.data(), n, shorter.data(), m);
+            trim_limbs(product);
+            return product;
+        }
+
+        // Unbalanced operands: multiply the shorter one by every piece
+        if (2 * m <= n)
+        {
+            for (uint64_t lo = 0; lo < n; lo += m)
+            {
+                uint64_t hi = min(n, lo + m);
+                vector<uint32_t> piece(longer.begin() + lo, longer.begin() + hi);
+                trim_limbs(piece);
+                vector<uint32_t> part = mul_limbs(piece, shorter, _threshold);
+                uint64_t carry = 0;
+                for (uint64_t i = 0; lo + i < n + m; i++)
+                {
+                    if (i >= part.size() && carry == 0)
+                    {
+                        break;
+                    }
+                    uint64_t cur = product[lo + i] + carry + (i < part.size() ? part[i] : 0);
+                    carry = cur >= LIMB_BASE;
+                    product[lo + i] = cur - carry * LIMB_BASE;
+                }
+            }
+            trim_limbs(product);
+            return product;
+        }
+
+        // a = a1 * B^h + a0, b = b1 * B^h + b0, then
+        // a * b = z2 * B^2h + (z1 - z2 - z0) * B^h + z0, where
+        // z0 = a0 * b0, z2 = a1 * b1, z1 = (a0 + a1) * (b0 + b1)
+        uint64_t h = n / 2;
+        vector<uint32_t> a0(longer.begin(), longer.begin() + h), a1(longer.begin() + h, longer.end());
+        vector<uint32_t> b0(shorter.begin(), shorter.begin() + min(h, m)), b1;
+        if (m > h)
+        {
+            b1.assign(shorter.begin() + h, shorter.end());
+        }
+        trim_limbs(a0);
+        trim_limbs(a1);
+        trim_limbs(b0);
+        trim_limbs(b1);
+        vector<uint32_t> z0 = mul_limbs(a0, b0, _threshold);
+        vector<uint32_t> z2 = mul_limbs(a1, b1, _threshold);
+        vector<uint32_t> z1 = sub_limbs(sub_limbs(mul_limbs(add_limbs(a0, a1), add_limbs(b0, b1), _threshold), z0), z2);
+
+        // Add the three parts at their offsets
+        const vector<uint32_t> *parts[3] = {&z0, &z1, &z2};
+        for (uint64_t k = 0; k < 3; k++)
+        {
+            uint64_t offset = k * h;
+            uint64_t carry = 0;
+            for (uint64_t i = 0; offset + i < n + m; i++)
+            {
+                if (i >= parts[k]->size() && carry == 0)
+                {
+                    break;
+                }
+                uint64_t cur = product[offset + i] + carry + (i < parts[k]->size() ? (*parts[k])[i] : 0);
+                carry = cur >= LIMB_BASE;
+                product[offset + i] = cur - carry * LIMB_BASE;
+            }
+        }
+        trim_limbs(product);
+        INFPRECISION_STATS_END(STATS_MUL_KARATSUBA, n * LIMB_DIGITS);
+        return product;
+    }
+
+    /**
+     * @brief Divide a magnitude by a small divisor in place
+     *
+     * @param _a Magnitude, replaced by the quotient
+     * @param _d Divisor, 0 < _d <= 2^32
+     * @return uint32_t The remainder
+     */
+    uint32_t divmod_small_limbs(vector<uint32_t> &_a, uint64_t _d)
+    {
+        uint64_t rem = 0;
+        for (uint64_t i = _a.size(); i-- > 0;)
+        {
+            uint64_t cur = rem * LIMB_BASE + _a[i];
+            _a[i] = cur / _d;
+            rem = cur % _d;
+        }
+        trim_limbs(_a);
+        return rem;
+    }
+
+    /**
+     * @brief Multiply a magnitude by a small factor and add a small term
+     * in place
+     *
+     * @param _a Magnitude, replaced by _a * _m + _add
+     * @param _m Factor, _m <= 2^32
+     * @param _add Term, _add < 2^32
+     */
+    void mul_small_limbs(vector<uint32_t> &_a, uint64_t _m, uint64_t _add = 0)
+    {
+        uint64_t carry = _add;
+        for (uint64_t i = 0; i < _a.size(); i++)
+        {
+            uint64_t cur = _a[i] * _m + carry;
+            _a[i] = cur % LIMB_BASE;
+            carry = cur / LIMB_BASE;
+        }
+        while (carry > 0)
+        {
+            _a.push_back(carry % LIMB_BASE);
+            carry /= LIMB_BASE;
+        }
+        trim_limbs(_a);
+    }
+
+    /**
+     * @brief Divide two magnitudes by the long division in base 10^9
+     * (Knuth, TAOCP Vol. 2, Algorithm D)
+     *
+     * @param _u Dividend
+     * @param _v Divisor, must not be 0
+     * @param _q Quotient
+     * @param _r Remainder
+     */
+    void divmod_limbs(const vector<uint32_t> &_u, const vector<uint32_t> &_v,
+                      vector<uint32_t> &_q, vector<uint32_t> &_r)
+    {
+        if (compare_limbs(_u, _v) < 0)
+        {
+            _q = {0};
+            _r = _u;
+            return;
+        }
+        if (_v.size() == 1)
+        {
+            _q = _u;
+            _r = {divmod_small_limbs(_q, _v[0])};
+            return;
+        }
+
+        // Scale both numbers so the leading divisor limb is at least 10^9 / 2,
+        // then every estimated quotient limb is off by at most 2
+        uint64_t n = _v.size();
+        uint64_t m = _u.size() - n;
+        uint64_t d = LIMB_BASE / ((uint64_t)_v.back() + 1);
+        vector<uint32_t> un(_u.size() + 1, 0);
+        vector<uint32_t> vn(n, 0);
+        un[_u.size()] = mul_1(un.data(), _u.data(), _u.size(), d);
+        mul_1(vn.data(), _v.data(), n, d);
+        uint64_t carry = 0;
+
+        _q.assign(m + 1, 0);
+        for (uint64_t j = m + 1; j-- > 0;)
+        {
+            // Estimate the quotient limb from the two leading limbs
+            uint64_t num = (uint64_t)un[j + n] * LIMB_BASE + un[j + n - 1];
+            uint64_t qhat = num / vn[n - 1];
+            uint64_t rhat = num % vn[n - 1];
+            while (qhat >= LIMB_BASE ||
+                   qhat * vn[n - 2] > rhat * LIMB_BASE + un[j + n - 2])
+            {
+                qhat--;
+                rhat += vn[n - 1];
+                if (rhat >= LIMB_BASE)
+                {
+                    break;
+                }
+            }
+
+            // Multiply and subtract qhat * divisor from the current window
+            int64_t top = (int64_t)un[j + n] - (int64_t)submul_1(un.data() + j, vn.data(), n, qhat);
+
+            // If qhat was still one too large, add the divisor back
+            if (top < 0)
+            {
+                qhat--;
+                carry = 0;
+                for (uint64_t i = 0; i < n; i++)
+                {
+                    uint64_t cur = (uint64_t)un[i + j] + vn[i] + carry;
+                    carry = cur >= LIMB_BASE;
+                    un[i + j] = cur - carry * LIMB_BASE;
+                }
+                top += carry;
+            }
+            un[j + n] = top;
+            _q[j] = qhat;
+        }
+        trim_limbs(_q);
+
+        // Unscale the remainder
+        un.resize(n);
+        trim_limbs(un);
+        divmod_small_limbs(un, d);
+        _r = un;
+    }
+
+    /**
+     * @brief Calculate (_a * _b) mod _m on magnitudes
+     *
+     */
+    vector<uint32_t> mulmod_limbs(const vector<uint32_t> &_a, const vector<uint32_t> &_b,
+                                  const vector<uint32_t> &_m)
+    {
+        vector<uint32_t> q, r;
+        divmod_limbs(mul_limbs(_a, _b), _m, q, r);
+        return r;
+    }
+
+    /**
+     * @brief Calculate (_base ^ _exp) mod _m on magnitudes. The exponent is
+     * consumed limb by limb from the most significant one, and every limb is
+     * processed as 9 decimal digits with a table of _base^0 ... _base^9.
+     *
+     */
+    vector<uint32_t> powmod_limbs(const vector<uint32_t> &_base, const vector<uint32_t> &_exp,
+                                  const vector<uint32_t> &_m)
+    {
+        vector<uint32_t> q, base;
+        divmod_limbs(_base, _m, q, base);
+
+        vector<vector<uint32_t>> table(10);
+        table[0] = {1};
+        divmod_limbs(table[0], _m, q, table[0]); // 1 mod 1 is 0
+        for (uint64_t i = 1; i < 10; i++)
+        {
+            table[i] = mulmod_limbs(table[i - 1], base, _m);
+        }
+
+        vector<uint32_t> result = table[0];
+        bool started = false;
+        for (uint64_t i = _exp.size(); i-- > 0;)
+        {
+            uint32_t limb = _exp[i];
+            uint32_t scale = LIMB_BASE / 10;
+            for (uint64_t j = 0; j < LIMB_DIGITS; j++)
+            {
+                uint32_t digit = limb / scale % 10;
+                scale /= 10;
+                if (started)
+                {
+                    // result = result^10 = ((result^2)^2 * result)^2
+                    vector<uint32_t> square = mulmod_limbs(result, result, _m);
+                    square = mulmod_limbs(square, square, _m);
+                    square = mulmod_limbs(square, result, _m);
+                    result = mulmod_limbs(square, square, _m);
+                }
+                if (digit != 0)
+                {
+                    result = started ? mulmod_limbs(result, table[digit], _m) : table[digit];
+                    started = true;
+                }
+            }
+        }
+        return result;
+    }
+
+    /**
+     * @brief Pack a 64-bit unsigned integer into limbs
+     *
+     */
+    vector<uint32_t> small_to_limbs(uint64_t _n)
+    {
+        vector<uint32_t> limbs;
+        do
+        {
+            limbs.push_back(_n % LIMB_BASE);
+            _n /= LIMB_BASE;
+        } while (_n > 0);
+        return limbs;
+    }
+
+    /**
+     * @brief Multiply the magnitudes in [_lo, _hi) by a balanced product tree,
+     * so both operands of every multiplication have similar sizes
+     *
+     * @param _factors The magnitudes to be multiplied
+     * @param _lo First index of the range
+     * @param _hi One past the last index of the range
+     * @return vector<uint32_t> The product, 1 for an empty range
+     */
+    vector<uint32_t> product_tree_limbs(const vector<vector<uint32_t>> &_factors,
+                                        uint64_t _lo, uint64_t _hi)
+    {
+        if (_hi <= _lo)
+        {
+            return {1};
+        }
+        if (_hi - _lo == 1)
+        {
+            return _factors[_lo];
+        }
+        uint64_t mid = _lo + (_hi - _lo) / 2;
+        return mul_limbs(product_tree_limbs(_factors, _lo, mid),
+                         product_tree_limbs(_factors, mid, _hi));
+    }
+
+    /**
+     * @brief Multiply many small factors by a product tree. Consecutive factors
+     * are firstly gathered into single limbs while their product stays below
+     * 10^9, so the leaves of the tree are as full as possible.
+     *
+     * @param _factors The factors to be multiplied
+     * @return vector<uint32_t> The product
+     */
+    vector<uint32_t> product_of_small(const vector<uint64_t> &_factors)
+    {
+        vector<vector<uint32_t>> leaves;
+        uint64_t acc = 1;
+        for (uint64_t f : _factors)
+        {
+            if (f != 0 && acc <= (LIMB_BASE - 1) / f)
+            {
+                acc *= f;
+                continue;
+            }
+            leaves.push_back(small_to_limbs(acc));
+            acc = f;
+        }
+        leaves.push_back(small_to_limbs(acc));
+        return product_tree_limbs(leaves, 0, leaves.size());
+    }
+
+    /**
+     * @brief Remove the most significant zero words, so 0 is the empty vector
+     *
+     */
+    void trim_words(vector<uint32_t> &_words)
+    {
+        while (!_words.empty() && _words.back() == 0)
+        {
+            _words.pop_back();
+        }
+    }
+
+    /**
+     * @brief Add _part * 2^(32 * _shift) to _acc in place, both in base 2^32
+     * words from the least significant word
+     *
+     */
+    void add_words_at(vector<uint32_t> &_acc, const vector<uint32_t> &_part, uint64_t _shift)
+    {
+        if (_acc.size() < _shift + _part.size())
+        {
+            _acc.resize(_shift + _part.size(), 0);
+        }
+        uint64_t carry = 0;
+        uint64_t i = 0;
+        for (; i < _part.size(); i++)
+        {
+            uint64_t cur = (uint64_t)_acc[_shift + i] + _part[i] + carry;
+            _acc[_shift + i] = (uint32_t)cur;
+            carry = cur >> 32;
+        }
+        for (; carry != 0; i++)
+        {
+            if (_shift + i == _acc.size())
+            {
+                _acc.push_back(0);
+            }
+            uint64_t cur = (uint64_t)_acc[_shift + i] + carry;
+            _acc[_shift + i] = (uint32_t)cur;
+            carry = cur >> 32;
+        }
+    }
+
+    /**
+     * @brief Subtract _part from _acc in place, both in base 2^32 words,
+     * _acc must not be smaller than _part
+     *
+     */
+    void sub_words(vector<uint32_t> &_acc, const vector<uint32_t> &_part)
+    {
+        uint64_t borrow = 0;
+        for (uint64_t i = 0; i < _acc.size() && (i < _part.size() || borrow != 0); i++)
+        {
+            uint64_t sub = (i < _part.size() ? _part[i] : 0) + borrow;
+            borrow = _acc[i] < sub;
+            _acc[i] = (uint32_t)(_acc[i] - sub);
+        }
+        trim_words(_acc);
+    }
+
+    /**
+     * @brief Multiply two magnitudes in base 2^32 words, by the schoolbook
+     * method for short operands and by Karatsuba's method above the same
+     * threshold as mul_limbs. A much longer operand is cut into pieces of
+     * the length of the shorter one.
+     *
+     */
+    vector<uint32_t> mul_words(const vector<uint32_t> &_a, const vector<uint32_t> &_b)
+    {
+        const vector<uint32_t> &longer = _a.size() >= _b.size() ? _a : _b;
+        const vector<uint32_t> &shorter = _a.size() >= _b.size() ? _b : _a;
+        uint64_t n = longer.size(), m = shorter.size();
+        if (m == 0)
+        {
+            return {};
+        }
+        vector<uint32_t> product;
+        if (m < INFPRECISION_KARATSUBA_THRESHOLD)
+        {
+            product.assign(n + m, 0);
+            for (uint64_t i = 0; i < m; i++)
+            {
+                uint64_t carry = 0;
+                for (uint64_t j = 0; j < n; j++)
+                {
+                    uint64_t cur = (uint64_t)shorter[i] * longer[j] + product[i + j] + carry;
+                    product[i + j] = (uint32_t)cur;
+                    carry = cur >> 32;
+                }
+                product[i + n] = (uint32_t)carry;
+            }
+        }
+        else if (2 * m <= n)
+        {
+            for (uint64_t lo = 0; lo < n; lo += m)
+            {
+                vector<uint32_t> piece(longer.begin() + lo, longer.begin() + min(n, lo + m));
+                trim_words(piece);
+                add_words_at(product, mul_words(piece, shorter), lo);
+            }
+        }
+        else
+        {
+            // x = x1 * 2^(32h) + x0, and x*y = z2 * 2^(64h) + z1 * 2^(32h) + z0
+            uint64_t h = n / 2;
+            vector<uint32_t> a0(longer.begin(), longer.begin() + h), a1(longer.begin() + h, longer.end());
+            vector<uint32_t> b0(shorter.begin(), shorter.begin() + min(h, m)), b1(shorter.begin() + min(h, m), shorter.end());
+            trim_words(a0);
+            trim_words(b0);
+            vector<uint32_t> z0 = mul_words(a0, b0), z2 = mul_words(a1, b1);
+            add_words_at(a0, a1, 0);
+            add_words_at(b0, b1, 0);
+            vector<uint32_t> z1 = mul_words(a0, b0);
+            sub_words(z1, z0);
+            sub_words(z1, z2);
+            product = z0;
+            add_words_at(product, z1, h);
+            add_words_at(product, z2, 2 * h);
+        }
+        trim_words(product);
+        return product;
+    }
+
+    const uint64_t CONVERT_LEAF = 32; // limbs or words converted one by one
+
+    /**
+     * @brief Convert the limbs [_lo, _hi) to words by dividing by 2^32 again
+     * and again, which is quadratic and only used for short ranges
+     *
+     */
+    vector<uint32_t> limbs_to_words_basecase(const vector<uint32_t> &_limbs, uint64_t _lo, uint64_t _hi)
+    {
+        vector<uint32_t> limbs(_limbs.begin() + _lo, _limbs.begin() + _hi);
+        trim_limbs(limbs);
+        vector<uint32_t> words;
+        while (!is_zero_limbs(limbs))
+        {
+            words.push_back(divmod_small_limbs(limbs, (uint64_t)1 << 32));
+        }
+        return words;
+    }
+
+    /**
+     * @brief Convert the limbs [_lo, _hi) to words by divide and conquer:
+     * the range is split at CONVERT_LEAF * 2^k limbs, and the high part is
+     * multiplied by 10^(9 * CONVERT_LEAF * 2^k), which is _powers[k] in words
+     *
+     */
+    vector<uint32_t> limbs_to_words_rec(const vector<uint32_t> &_limbs, uint64_t _lo, uint64_t _hi,
+                                        vector<vector<uint32_t>> &_powers)
+    {
+        if (_hi - _lo <= CONVERT_LEAF)
+        {
+            return limbs_to_words_basecase(_limbs, _lo, _hi);
+        }
+        uint64_t k = 0;
+        for (; (CONVERT_LEAF << (k + 1)) < _hi - _lo; k++)
+        {
+        }
+        while (_powers.size() <= k)
+        {
+            if (_powers.empty())
+            {
+                vector<uint32_t> power(CONVERT_LEAF + 1, 0);
+                power.back() = 1;
+                _powers.push_back(limbs_to_words_basecase(power, 0, power.size()));
+            }
+            else
+            {
+                _powers.push_back(mul_words(_powers.back(), _powers.back()));
+            }
+        }
+        uint64_t mid = _lo + (CONVERT_LEAF << k);
+        vector<uint32_t> words = mul_words(limbs_to_words_rec(_limbs, mid, _hi, _powers), _powers[k]);
+        add_words_at(words, limbs_to_words_rec(_limbs, _lo, mid, _powers), 0);
+        trim_words(words);
+        return words;
+    }
+
+    /**
+     * @brief Convert a magnitude from base 10^9 limbs to base 2^32 words,
+     * stored from the least significant word, 0 is the empty vector. Long
+     * magnitudes are split in halves by divide and conquer, so the cost is
+     * that of a few multiplications instead of quadratic.
+     *
+     */
+    vector<uint32_t> limbs_to_words(const vector<uint32_t> &_limbs)
+    {
+        vector<vector<uint32_t>> powers;
+        return limbs_to_words_rec(_limbs, 0, _limbs.size(), powers);
+    }
+
+    /**
+     * @brief Convert the words [_lo, _hi) to limbs by multiplying by 2^32
+     * again and again, which is quadratic and only used for short ranges
+     *
+     */
+    vector<uint32_t> words_to_limbs_basecase(const vector<uint32_t> &_words, uint64_t _lo, uint64_t _hi)
+    {
+        vector<uint32_t> limbs = {0};
+        for (uint64_t i = _hi; i-- > _lo;)
+        {
+            mul_small_limbs(limbs, (uint64_t)1 << 32, _words[i]);
+        }
+        return limbs;
+    }
+
+    /**
+     * @brief Convert the words [_lo, _hi) to limbs by divide and conquer,
+     * the same way as limbs_to_words_rec with _powers[k] being
+     * 2^(32 * CONVERT_LEAF * 2^k) in limbs
+     *
+     */
+    vector<uint32_t> words_to_limbs_rec(const vector<uint32_t> &_words, uint64_t _lo, uint64_t _hi,
+                                        vector<vector<uint32_t>> &_powers)
+    {
+        if (_hi - _lo <= CONVERT_LEAF)
+        {
+            return words_to_limbs_basecase(_words, _lo, _hi);
+        }
+        uint64_t k = 0;
+        for (; (CONVERT_LEAF << (k + 1)) < _hi - _lo; k++)
+        {
+        }
+        while (_powers.size() <= k)
+        {
+            if (_powers.empty())
+            {
+                vector<uint32_t> power(CONVERT_LEAF + 1, 0);
+                power.back() = 1;
+                _powers.push_back(words_to_limbs_basecase(power, 0, power.size()));
+            }
+            else
+            {
+                _powers.push_back(mul_limbs(_powers.back(), _powers.back()));
+            }
+        }
+        uint64_t mid = _lo + (CONVERT_LEAF << k);
+        vector<uint32_t> high = words_to_limbs_rec(_words, mid, _hi, _powers);
+        vector<uint32_t> limbs = add_limbs(mul_limbs(high, _powers[k]), words_to_limbs_rec(_words, _lo, mid, _powers));
+        trim_limbs(limbs);
+        return limbs;
+    }
+
+    /**
+     * @brief Convert a magnitude from base 2^32 words back to base 10^9
+     * limbs, by divide and conquer for long magnitudes
+     *
+     */
+    vector<uint32_t> words_to_limbs(const vector<uint32_t> &_words)
+    {
+        vector<vector<uint32_t>> powers;
+        return words_to_limbs_rec(_words, 0, _words.size(), powers);
+    }
+
+    /**
+     * @brief Calculate 2^_exp in limbs by repeated squaring
+     *
+     */
+    vector<uint32_t> pow2_limbs(uint64_t _exp)
+    {
+        vector<uint32_t> power = {1};
+        for (uint64_t bit = 64; bit-- > 0;)
+        {
+            if (power.size() > 1 || power[0] > 1)
+            {
+                power = mul_limbs(power, power);
+            }
+            if ((_exp >> bit) & 1)
+            {
+                mul_small_limbs(power, 2);
+            }
+        }
+        return power;
+    }
+
+    /**
+     * @brief Get the bit length of a magnitude in words
+     *
+     */
+    uint64_t bit_length_words(const vector<uint32_t> &_words)
+    {
+        uint64_t length = _words.empty() ? 0 : (_words.size() - 1) * 32;
+        for (uint32_t top = _words.empty() ? 0 : _words.back(); top != 0; top >>= 1)
+        {
+            length++;
+        }
+        return length;
+    }
+
+    /**
+     * @brief Get the two's complement form of a magnitude in words and its
+     * sign in _size words of 2^32, the last word holds the sign
+     *
+     */
+    vector<uint32_t> to_twos_complement(vector<uint32_t> _words, bool _negative, uint64_t _size)
+    {
+        _words.resize(_size, 0);
+        if (_negative)
+        {
+            // -x = ~x + 1
+            uint64_t carry = 1;
+            for (uint64_t i = 0; i < _size; i++)
+            {
+                uint64_t cur = (uint64_t)(uint32_t)~_words[i] + carry;
+                _words[i] = (uint32_t)cur;
+                carry = cur >> 32;
+            }
+        }
+        return _words;
+    }
+
+    /**
+     * @brief Get the infPrecision object from its two's complement form,
+     * where the sign is the top bit of the last word
+     *
+     */
+    infPrecision from_twos_complement(vector<uint32_t> _words)
+    {
+        bool negative = !_words.empty() && (_words.back() >> 31) == 1;
+        if (negative)
+        {
+            // |x| = ~x + 1
+            uint64_t carry = 1;
+            for (uint64_t i = 0; i < _words.size(); i++)
+            {
+                uint64_t cur = (uint64_t)(uint32_t)~_words[i] + carry;
+                _words[i] = (uint32_t)cur;
+                carry = cur >> 32;
+            }
+        }
+        trim_words(_words);
+        return from_limbs(words_to_limbs(_words), negative);
+    }
+
+    /**
+     * @brief Apply a bitwise operator to two infPrecision objects in two's
+     * complement form, word by word. Every operand is converted to words
+     * once, and both forms get one extra word for the sign.
+     *
+     */
+    template <class Op>
+    infPrecision bitwise_words(const infPrecision &_infP1, const infPrecision &_infP2, Op _op)
+    {
+        vector<uint32_t> words1 = limbs_to_words(to_limbs(_infP1));
+        vector<uint32_t> words2 = limbs_to_words(to_limbs(_infP2));
+        uint64_t size = max(words1.size(), words2.size()) + 1;
+        words1 = to_twos_complement(words1, _infP1.is_negative(), size);
+        words2 = to_twos_complement(words2, _infP2.is_negative(), size);
+        for (uint64_t i = 0; i < size; i++)
+        {
+            words1[i] = _op(words1[i], words2[i]);
+        }
+        return from_twos_complement(words1);
+    }
+}
+
+/**
+ * @brief Overloaded binary operator + to calculate the summation of the
+ * first infPrecision object with the second infPrecision object. It works on
+ * the absolute values: if both integers have the same sign, their absolute
+ * values are added, otherwise the smaller absolute value is subtracted from
+ * the greater one, and the result takes the sign of the greater one.
+ *
+ * @param _infP1 The first infinite precision integer
+ * @param _infP2 The second infinite precision integer
+ * @return infPrecision A infPrecision object as the result of addition.
+ */
+INFPRECISION_CONSTEXPR infPrecision operator+(const infPrecision &_infP1, const infPrecision &_infP2)
+{
+    INFPRECISION_STATS_BEGIN();
+    vector<int64_t> vec1 = _infP1.get_vec();
+    vector<int64_t> vec2 = _infP2.get_vec();
+    bool neg1 = _infP1.is_negative();
+    bool neg2 = _infP2.is_negative();
+    vec1[0] = infPrecision_detail::abs_digit(vec1[0]);
+    vec2[0] = infPrecision_detail::abs_digit(vec2[0]);
+
+    // Let vec1 hold the greater absolute value
+    if (infPrecision_detail::compare_digits(vec1.data(), vec1.size(), vec2.data(), vec2.size()) < 0)
+    {
+        swap(vec1, vec2);
+        swap(neg1, neg2);
+    }
+
+    vector<int64_t> sum; // store result
+    if (neg1 == neg2)
+    {
+        // x + y = -(-x + -y) if both are negative
+        sum.assign(vec1.size() + 1, 0);
+        infPrecision_detail::add_digits(vec1.data(), vec1.size(), vec2.data(), vec2.size(), sum.data());
+    }
+    else
+    {
+        // x + y = x - |y| if x > 0 > y and |x| >= |y|
+        sum.assign(vec1.size(), 0);
+        infPrecision_detail::sub_digits(vec1.data(), vec1.size(), vec2.data(), vec2.size(), sum.data());
+    }
+
+    // Remove all leading 0s at once, a single 0 is kept for integer 0
+    uint64_t first = 0;
+    while (first + 1 < sum.size() && sum[first] == 0)
+    {
+        first++;
+    }
+    sum.erase(sum.begin(), sum.begin() + first);
+    if (neg1 && sum[0] != 0)
+    {
+        sum[0] *= (-1);
+    }
+    INFPRECISION_STATS_END(STATS_ADD, vec1.size());
+    return infPrecision(infPrecision_detail::trusted, std::move(sum));
+}
+
+/**
+ * @brief Overloaded binary operator += to assign the new value of the left
+ * infPrecision object after it plus the right infPrecision object
+ *
+ * @param _infP1 The first infinite precision integer
+ * @param _infP2 The second infinite precision integer
+ * @return infPrecision A infPrecision object as the result of subtraction.
+ */
+INFPRECISION_CONSTEXPR infPrecision operator+=(infPrecision &_infP1, const infPrecision &_infP2)
+{
+    _infP1 = _infP1 + _infP2;
+    return _infP1;
+}
+
+/**
+ * @brief Overloaded binary operator - to calculate the subtraction of the
+ * left infPrecision object with the right infPrecision object
+ *
+ * @param _infP1 The first infinite precision integer
+ * @param _infP2 The second infinite precision integer
+ * @return infPrecision Reassign _infP1 with the result of addition
+ */
+INFPRECISION_CONSTEXPR infPrecision operator-(const infPrecision &_infP1, const infPrecision &_infP2)
+{
+    infPrecision subtraction;
+    // if x > 0, y < 0, then x - y = x + y' = x + (-y), where y'= -y
+    if (_infP1.is_negative() == 0 && _infP2.is_negative() == 1)
+    {
+        subtraction = _infP1 + (-_infP2);
+        return subtraction;
+    }
+
+    // if x < 0, y < 0, then x - y = (-x') - (-y') = y'- x' = (-y) + x,
+    // where x'= -x, y'= -y
+    else if (_infP1.is_negative() == 1 && _infP2.is_negative() == 1)
+    {
+        subtraction = (-_infP2) + _infP1;
+        return subtraction;
+    }
+
+    // if x < 0, y > 0, then x - y = -x'- y = -(x'+ y), where x'= -x
+    else if (_infP1.is_negative() == 1 && _infP2.is_negative() == 0)
+    {
+        subtraction = -((-_infP1) + _infP2);
+        return subtraction;
+    }
+
+    // If x > 0 and y > 0, we have the regular subtraction
+    // x - y = x + (-y)
+    subtraction = _infP1 + (-(_infP2));
+    return subtraction;
+}
+
+/**
+ * @brief Overloaded binary operator -= to assign the new value of the first
+ * infPrecision object after it subtracts the second infPrecision object
+ *
+ * @param _infP1 The first infinite precision integer
+ * @param _infP2 The second infinite precision integer
+ * @return infPrecision Reassign _infP1 with the result of multiplication
+ */
+INFPRECISION_CONSTEXPR infPrecision operator-=(infPrecision &_infP1, const infPrecision &_infP2)
+{
+    _infP1 = _infP1 - _infP2;
+    return _infP1;
+}
+
+/**
+ * @brief Overloaded binary operator * to calculate the multiplication of the
+ * first infPrecision object with the second infPrecision object
+ *
+ * @param _infP1 The first infinite precision integer
+ * @param _infP2 The second infinite precision integer
+ * @return infPrecision The result of multiplication in a new infinite
+ * precision integer
+ */
+INFPRECISION_CONSTEXPR infPrecision operator*(const infPrecision &_infP1, const infPrecision &_infP2)
+{
+    INFPRECISION_STATS_BEGIN();
+    // Multiply the magnitudes in base 10^9, see mul_limbs
+    vector<uint32_t> product = infPrecision_detail::mul_limbs(infPrecision_detail::to_limbs(_infP1),
+                                                              infPrecision_detail::to_limbs(_infP2));
+
+    // If there is one negative number, then the product should be negative
+    infPrecision multiplication = infPrecision_detail::from_limbs(product, _infP1.is_negative() != _infP2.is_negative());
+    INFPRECISION_STATS_END(STATS_MUL, max(_infP1.num_digits(), _infP2.num_digits()));
+    return multiplication;
+}
+
+/**
+ * @brief Overloaded binary operator *= to assign the new value of the first
+ * infPrecision object after it multiplies the second infPrecision object
+ *
+ * @param _infP1 The first infinite precision integer
+ * @param _infP2 The second infinite precision integer
+ * @return infPrecision Reassign _infP1 with the result of multiplication
+ */
+INFPRECISION_CONSTEXPR infPrecision operator*=(infPrecision &_infP1, const infPrecision &_infP2)
+{
+    _infP1 = _infP1 * _infP2;
+    return _infP1;
+}
+
+/**
+ * @brief Overloaded unary operator - to get the negative of
+ * infPrecision object
+ *
+ * @param _infP The infinite precision integer
+ * @return infPrecision The negated infinite precision integer
+ */
+INFPRECISION_CONSTEXPR infPrecision operator-(const infPrecision &_infP)
+{
+    vector<int64_t> temp = _infP.get_vec();
+    temp[0] = temp[0] * (-1); // First digit multiplies -1
+    return infPrecision(infPrecision_detail::trusted, std::move(temp));
+}
+
+/**
+ * @brief Overloaded binary operator == to determine if the first
+ * infPrecision object is equal to the second infPrecision object
+ *
+ * @param _infP1 The first infinite precision integer
+ * @param _infP2 The second infinite precision integer
+ * @return bool Return true if two infPrecision are equal, false otherwise
+ */
+INFPRECISION_CONSTEXPR bool operator==(const infPrecision &_infP1, const infPrecision &_infP2)
+{
+    const vector<int64_t> &vec1 = _infP1.digits();
+    const vector<int64_t> &vec2 = _infP2.digits();
+    // The same object, or copies sharing their digits
+    if (&vec1 == &vec2)
+    {
+        return true;
+    }
+    // The lengths and the signs are checked before any digit is compared
+    if (vec1.size() != vec2.size() || _infP1.is_negative() != _infP2.is_negative())
+    {
+        return false;
+    }
+    return infPrecision_detail::compare_magnitude(vec1, vec2) == 0;
+}
+
+/**
+ * @brief Overloaded binary operator != to determine if the first
+ * infPrecision object is unequal to the second infPrecision object
+ *
+ * @param _infP1 The first infinite precision integer
+ * @param _infP2 The second infinite precision integer
+ * @return bool Return true if two infPrecision are unequal, false otherwise
+ */
+INFPRECISION_CONSTEXPR bool operator!=(const infPrecision &_infP1, const infPrecision &_infP2)
+{
+    return !(_infP1 == _infP2);
+}
+
+/**
+ * @brief Overloaded binary operator < to determine if the first
+ * infPrecision object is smaller than the second infPrecision object
+ *
+ * @param _infP1 The first infinite precision integer
+ * @param _infP2 The second infinite precision integer
+ * @return bool Return true if first infPrecision is smaller than
+ * second infPrecision, false otherwise
+ */
+INFPRECISION_CONSTEXPR bool operator<(const infPrecision &_infP1, const infPrecision &_infP2)
+{
+    INFPRECISION_STATS_BEGIN();
+    // if x is negative, y is non-negative, then x<y (and the reverse)
+    bool smaller = _infP1.is_negative();
+    if (_infP1.is_negative() == _infP2.is_negative())
+    {
+        // if x,y have the same sign, compare their absolute values digit by
+        // digit from the left, the first different digit decides the order.
+        // For negative numbers, the larger absolute value is the smaller value.
+        int order = infPrecision_detail::compare_magnitude(_infP1.digits(), _infP2.digits());
+        smaller = _infP1.is_negative() ? order > 0 : order < 0;
+    }
+    INFPRECISION_STATS_END(STATS_COMPARE, max(_infP1.num_digits(), _infP2.num_digits()));
+    return smaller;
+}
+
+/**
+ * @brief Overloaded binary operator <= to determine if the first
+ * infPrecision object is smaller than or equal to the second infPrecision object
+ *
+ * @param _infP1 The first infinite precision integer
+ * @param _infP2 The second infinite precision integer
+ * @return bool Return true if first infPrecision is smaller than or equal to the
+ * second infPrecision, false otherwise
+ */
+INFPRECISION_CONSTEXPR bool operator<=(const infPrecision &_infP1, const infPrecision &_infP2)
+{
+    if (_infP1 < _infP2 || _infP1 == _infP2)
+    {
+        return true;
+    }
+    return false;
+}
+
+/**
+ * @brief Overloaded binary operator > to determine if the first
+ * infPrecision object is greater than the second infPrecision object
+ *
+ * @param _infP1 The first infinite precision integer
+ * @param _infP2 The second infinite precision integer
+ * @return bool Return true if first infPrecision is greater than the
+ * second infPrecision, false otherwise
+ */
+INFPRECISION_CONSTEXPR bool operator>(const infPrecision &_infP1, const infPrecision &_infP2)
+{
+    INFPRECISION_STATS_BEGIN();
+    // if x is non-negative, y is negative, then x>y (and the reverse)
+    bool greater = _infP2.is_negative();
+    if (_infP1.is_negative() == _infP2.is_negative())
+    {
+        // if x,y have the same sign, compare their absolute values digit by
+        // digit from the left, the first different digit decides the order.
+        // For negative numbers, the smaller absolute value is the greater value.
+        int order = infPrecision_detail::compare_magnitude(_infP1.digits(), _infP2.digits());
+        greater = _infP1.is_negative() ? order < 0 : order > 0;
+    }
+    INFPRECISION_STATS_END(STATS_COMPARE, max(_infP1.num_digits(), _infP2.num_digits()));
+    return greater;
+}
+
+/**
+ * @brief Overloaded binary operator >= to determine if the first
+ * infPrecision object is greater than or equal to the second infPrecision object
+ *
+ * @param _infP1 The first infinite precision integer
+ * @param _infP2 The second infinite precision integer
+ * @return bool Return true if first infPrecision is greater than or equal to the
+ * second infPrecision, false otherwise
+ */
+INFPRECISION_CONSTEXPR bool operator>=(const infPrecision &_infP1, const infPrecision &_infP2)
+{
+    if (_infP1 > _infP2 || _infP1 == _infP2)
+    {
+        return true;
+    }
+    return false;
+}
+
+/**
+ * @brief Write the digits of a infPrecision object to an ostream in blocks
+ * of characters, straight from the stored vector without copying it
+ *
+ * @param _out An ostream object
+ * @param _infP A infPrecision object
+ * @param _block The number of characters written at once
+ * @return ostream& Returns a reference to the ostream object.
+ */
+ostream &write_integer(ostream &_out, const infPrecision &_infP, uint64_t _block)
+{
+    const vector<int64_t> &digits = _infP.digits();
+    string buffer;
+    buffer.reserve(min<uint64_t>(_block, digits.size() + 1));
+    if (_infP.is_negative())
+    {
+        buffer.push_back('-');
+    }
+    for (uint64_t i = 0; i < digits.size(); i++)
+    {
+        buffer.push_back('0' + infPrecision_detail::abs_digit(digits[i]));
+        if (buffer.size() >= _block)
+        {
+            _out.write(buffer.data(), buffer.size());
+            buffer.clear();
+        }
+    }
+    return _out.write(buffer.data(), buffer.size());
+}
+
+/**
+ * @brief Read an integer from an istream character by character, straight
+ * into the digit vector, so no string holds the whole integer. Leading
+ * whitespace is skipped, the integer may start with '-', and reading stops
+ * before the first character which is not a digit.
+ *
+ * @param _in An istream object, its failbit is set if there is no digit
+ * @return infPrecision The integer read, 0 if there is no digit
+ */
+infPrecision read_integer(istream &_in)
+{
+    istream::sentry sentry(_in); // skips the whitespace
+    if (!sentry)
+    {
+        return infPrecision();
+    }
+    streambuf *buf = _in.rdbuf();
+    bool negative = buf->sgetc() == '-';
+    if (negative)
+    {
+        buf->sbumpc();
+    }
+
+    vector<int64_t> digits;
+    int c = buf->sgetc();
+    for (; c != char_traits<char>::eof() && infPrecision_detail::is_digit_char(c); c = buf->snextc())
+    {
+        digits.push_back(c - '0');
+    }
+    if (c == char_traits<char>::eof())
+    {
+        _in.setstate(ios_base::eofbit);
+    }
+    if (digits.empty())
+    {
+        _in.setstate(ios_base::failbit);
+        return infPrecision();
+    }
+    // If an integer which is not 0, has leading 0s, throw exception
+    if (digits[0] == 0 && digits.size() > 1)
+    {
+        throw infPrecision::cannot_leadZero();
+    }
+    if (negative)
+    {
+        digits[0] *= (-1);
+    }
+    return infPrecision(infPrecision_detail::trusted, std::move(digits));
+}
+
+/**
+ * @brief Overloaded binary operator << to print the
+ * integer stored in infPrecision object
+ *
+ * @param out An ostream object
+ * @param _infP A infPrecision object
+ * @return ostream& Returns a reference to an ostream object.
+ */
+ostream &operator<<(ostream &out, const infPrecision &_infP)
+{
+    INFPRECISION_STATS_BEGIN();
+    write_integer(out, _infP);
+    INFPRECISION_STATS_END(STATS_INSERT, _infP.num_digits());
+    return out;
+}
+
+/**
+ * @brief Overloaded binary operator >> to read an integer from an istream,
+ * see read_integer()
+ *
+ * @param in An istream object
+ * @param _infP A infPrecision object, 0 if no integer can be read
+ * @return istream& Returns a reference to an istream object.
+ */
+istream &operator>>(istream &in, infPrecision &_infP)
+{
+    _infP = read_integer(in);
+    return in;
+}
+namespace infPrecision_detail
+{
+    /**
+     * @brief Test if the characters of an integer literal form a decimal
+     * integer without leading zeros, digit separators (') are allowed
+     *
+     * @param _chars Characters of the literal
+     * @param _size Number of characters
+     */
+    constexpr bool is_decimal_literal(const char *_chars, uint64_t _size)
+    {
+        for (uint64_t i = 0; i < _size; i++)
+        {
+            if (!is_digit_char(_chars[i]) && _chars[i] != '\'')
+            {
+                return false;
+            }
+        }
+        return !(_chars[0] == '0' && _size > 1);
+    }
+}
+
+/**
+ * @brief User-defined literal to write an infinite precision integer in the
+ * source code, as 123456789012345678901234567890_inf (a negative integer is
+ * written with unary -). The digits are checked when the program compiles,
+ * so a wrong literal is a compile error and nothing is validated at run
+ * time. With C++20 the whole construction can be evaluated in constexpr.
+ *
+ * @tparam Digits Characters of the literal
+ * @return infPrecision The integer written by the literal
+ */
+template <char... Digits>
+INFPRECISION_CONSTEXPR infPrecision operator""_inf()
+{
+    constexpr char chars[] = {Digits...};
+    static_assert(infPrecision_detail::is_decimal_literal(chars, sizeof...(Digits)),
+                  "An infPrecision literal must be a decimal integer without leading zeros");
+    vector<int64_t> vec;
+    vec.reserve(sizeof...(Digits));
+    for (char c : chars)
+    {
+        if (c != '\'')
+        {
+            vec.push_back(c - '0');
+        }
+    }
+    return infPrecision(infPrecision_detail::trusted, std::move(vec));
+}
+
+/**
+ * @brief Count the set bits in the absolute value of the integer
+ *
+ * @return uint64_t The number of 1s in the binary form of |x|
+ */
+uint64_t infPrecision::popcount() const
+{
+    uint64_t count = 0;
+    for (uint32_t word : infPrecision_detail::limbs_to_words(infPrecision_detail::to_limbs(*this)))
+    {
+        // Clear the lowest set bit until the word is empty
+        for (; word != 0; word &= word - 1)
+        {
+            count++;
+        }
+    }
+    return count;
+}
+
+/**
+ * @brief Get the number of bits needed to store the absolute value of
+ * the integer
+ *
+ * @return uint64_t The bit length, 0 for integer 0
+ */
+uint64_t infPrecision::bit_length() const
+{
+    return infPrecision_detail::bit_length_words(infPrecision_detail::limbs_to_words(infPrecision_detail::to_limbs(*this)));
+}
+
+/**
+ * @brief Test one bit of the integer in two's complement form
+ *
+ * @param _pos Position of the bit, 0 is the least significant bit
+ * @return bool Return true if the bit is 1, false otherwise
+ */
+bool infPrecision::test_bit(uint64_t _pos) const
+{
+    vector<uint32_t> words = infPrecision_detail::limbs_to_words(infPrecision_detail::to_limbs(*this));
+    // Beyond the magnitude, every bit is a copy of the sign
+    if (_pos / 32 >= words.size())
+    {
+        return is_negative();
+    }
+    words = infPrecision_detail::to_twos_complement(words, is_negative(), words.size() + 1);
+    return (words[_pos / 32] >> (_pos % 32)) & 1;
+}
+
+/**
+ * @brief Set or clear one bit of the integer in two's complement form
+ *
+ * @param _pos Position of the bit, 0 is the least significant bit
+ * @param _value True to set the bit, false to clear it
+ * @return infPrecision& The integer after the bit is changed
+ */
+infPrecision &infPrecision::set_bit(uint64_t _pos, bool _value)
+{
+    vector<uint32_t> words = infPrecision_detail::limbs_to_words(infPrecision_detail::to_limbs(*this));
+    uint64_t size = max<uint64_t>(words.size(), _pos / 32 + 1) + 1;
+    words = infPrecision_detail::to_twos_complement(words, is_negative(), size);
+    if (_value)
+    {
+        words[_pos / 32] |= (uint32_t)1 << (_pos % 32);
+    }
+    else
+    {
+        words[_pos / 32] &= ~((uint32_t)1 << (_pos % 32));
+    }
+    *this = infPrecision_detail::from_twos_complement(words);
+    return *this;
+}
+
+/**
+ * @brief Overloaded binary operator << to shift the integer to the left,
+ * which is the multiplication by 2^_shift. 2^_shift is built once by
+ * squaring, then the magnitude is multiplied by it with mul_limbs.
+ *
+ * @param _infP The infinite precision integer
+ * @param _shift The number of bits to shift
+ * @return infPrecision The shifted integer
+ */
+infPrecision operator<<(const infPrecision &_infP, uint64_t _shift)
+{
+    vector<uint32_t> limbs = infPrecision_detail::to_limbs(_infP);
+    if (infPrecision_detail::is_zero_limbs(limbs))
+    {
+        return _infP;
+    }
+    if (_shift < 32)
+    {
+        infPrecision_detail::mul_small_limbs(limbs, (uint64_t)1 << _shift);
+    }
+    else
+    {
+        limbs = infPrecision_detail::mul_limbs(limbs, infPrecision_detail::pow2_limbs(_shift));
+    }
+    return infPrecision_detail::from_limbs(limbs, _infP.is_negative());
+}
+
+/**
+ * @brief Overloaded binary operator <<= to assign the left shifted value
+ *
+ * @param _infP The infinite precision integer
+ * @param _shift The number of bits to shift
+ * @return infPrecision Reassign _infP with the shifted integer
+ */
+infPrecision operator<<=(infPrecision &_infP, uint64_t _shift)
+{
+    _infP = _infP << _shift;
+    return _infP;
+}
+
+/**
+ * @brief Overloaded binary operator >> to shift the integer to the right
+ * arithmetically, which is the division by 2^_shift rounded toward negative
+ * infinity (-5 >> 1 = -3), the same as shifting the two's complement form.
+ * If the divisor 2^_shift or the quotient is short, the magnitude is
+ * divided by 2^_shift with divmod_limbs. Otherwise the magnitude is
+ * converted to words once, the words are moved and converted back.
+ *
+ * @param _infP The infinite precision integer
+ * @param _shift The number of bits to shift
+ * @return infPrecision The shifted integer
+ */
+infPrecision operator>>(const infPrecision &_infP, uint64_t _shift)
+{
+    vector<uint32_t> limbs = infPrecision_detail::to_limbs(_infP);
+    bool inexact = false; // True if a shifted out bit is 1
+    uint64_t n = limbs.size();
+    if (_shift >= 30 * n)
+    {
+        // |x| < 10^(9n) < 2^(30n), so every bit is shifted out
+        inexact = !infPrecision_detail::is_zero_limbs(limbs);
+        limbs = {0};
+    }
+    else if (_shift < 32)
+    {
+        inexact = infPrecision_detail::divmod_small_limbs(limbs, (uint64_t)1 << _shift) != 0;
+    }
+    else if ((double)(_shift / 30 + 1) * (n - _shift / 30) < 4 * pow((double)n, 1.585))
+    {
+        // The long division costs about (limbs of 2^_shift) * (limbs of the
+        // quotient), less than the two conversions, which cost about as
+        // much as two products of n limbs by Karatsuba's method
+        vector<uint32_t> q, r;
+        infPrecision_detail::divmod_limbs(limbs, infPrecision_detail::pow2_limbs(_shift), q, r);
+        inexact = !infPrecision_detail::is_zero_limbs(r);
+        limbs = q;
+    }
+    else
+    {
+        vector<uint32_t> words = infPrecision_detail::limbs_to_words(limbs);
+        uint64_t skip = min<uint64_t>(_shift / 32, words.size()), bits = _shift % 32;
+        for (uint64_t i = 0; i < skip && !inexact; i++)
+        {
+            inexact = words[i] != 0;
+        }
+        words.erase(words.begin(), words.begin() + skip);
+        if (bits != 0 && !words.empty())
+        {
+            inexact |= (words[0] & (((uint32_t)1 << bits) - 1)) != 0;
+            for (uint64_t i = 0; i < words.size(); i++)
+            {
+                uint32_t next = i + 1 < words.size() ? words[i + 1] : 0;
+                words[i] = (words[i] >> bits) | (next << (32 - bits));
+            }
+            infPrecision_detail::trim_words(words);
+        }
+        limbs = infPrecision_detail::words_to_limbs(words);
+    }
+
+    // A negative integer rounds away from 0 if bits are lost
+    if (_infP.is_negative() && inexact)
+    {
+        limbs = infPrecision_detail::add_limbs(limbs, {1});
+    }
+    return infPrecision_detail::from_limbs(limbs, _infP.is_negative());
+}
+
+/**
+ * @brief Overloaded binary operator >>= to assign the right shifted value
+ *
+ * @param _infP The infinite precision integer
+ * @param _shift The number of bits to shift
+ * @return infPrecision Reassign _infP with the shifted integer
+ */
+infPrecision operator>>=(infPrecision &_infP, uint64_t _shift)
+{
+    _infP = _infP >> _shift;
+    return _infP;
+}
+
+/**
+ * @brief Overloaded binary operator & to calculate the bitwise and of two
+ * infPrecision objects in two's complement form, word by word
+ *
+ * @param _infP1 The first infinite precision integer
+ * @param _infP2 The second infinite precision integer
+ * @return infPrecision The result of bitwise and
+ */
+infPrecision operator&(const infPrecision &_infP1, const infPrecision &_infP2)
+{
+    return infPrecision_detail::bitwise_words(_infP1, _infP2, [](uint32_t _w1, uint32_t _w2) { return _w1 & _w2; });
+}
+
+/**
+ * @brief Overloaded binary operator &= to assign the bitwise and
+ *
+ * @param _infP1 The first infinite precision integer
+ * @param _infP2 The second infinite precision integer
+ * @return infPrecision Reassign _infP1 with the result of bitwise and
+ */
+infPrecision operator&=(infPrecision &_infP1, const infPrecision &_infP2)
+{
+    _infP1 = _infP1 & _infP2;
+    return _infP1;
+}
+
+/**
+ * @brief Overloaded binary operator | to calculate the bitwise or of two
+ * infPrecision objects in two's complement form, word by word
+ *
+ * @param _infP1 The first infinite precision integer
+ * @param _infP2 The second infinite precision integer
+ * @return infPrecision The result of bitwise or
+ */
+infPrecision operator|(const infPrecision &_infP1, const infPrecision &_infP2)
+{
+    return infPrecision_detail::bitwise_words(_infP1, _infP2, [](uint32_t _w1, uint32_t _w2) { return _w1 | _w2; });
+}
+
+/**
+ * @brief Overloaded binary operator |= to assign the bitwise or
+ *
+ * @param _infP1 The first infinite precision integer
+ * @param _infP2 The second infinite precision integer
+ * @return infPrecision Reassign _infP1 with the result of bitwise or
+ */
+infPrecision operator|=(infPrecision &_infP1, const infPrecision &_infP2)
+{
+    _infP1 = _infP1 | _infP2;
+    return _infP1;
+}
+
+/**
+ * @brief Overloaded binary operator ^ to calculate the bitwise exclusive or
+ * of two infPrecision objects in two's complement form, word by word
+ *
+ * @param _infP1 The first infinite precision integer
+ * @param _infP2 The second infinite precision integer
+ * @return infPrecision The result of bitwise exclusive or
+ */
+infPrecision operator^(const infPrecision &_infP1, const infPrecision &_infP2)
+{
+    return infPrecision_detail::bitwise_words(_infP1, _infP2, [](uint32_t _w1, uint32_t _w2) { return _w1 ^ _w2; });
+}
+
+/**
+ * @brief Overloaded binary operator ^= to assign the bitwise exclusive or
+ *
+ * @param _infP1 The first infinite precision integer
+ * @param _infP2 The second infinite precision integer
+ * @return infPrecision Reassign _infP1 with the result of bitwise exclusive or
+ */
+infPrecision operator^=(infPrecision &_infP1, const infPrecision &_infP2)
+{
+    _infP1 = _infP1 ^ _infP2;
+    return _infP1;
+}
+
+/**
+ * @brief Overloaded unary operator ~ to get the bitwise not of a
+ * infPrecision object in two's complement form, which is -x - 1
+ *
+ * @param _infP The infinite precision integer
+ * @return infPrecision The result of bitwise not
+ */
+infPrecision operator~(const infPrecision &_infP)
+{
+    vector<uint32_t> limbs = infPrecision_detail::to_limbs(_infP);
+    // ~x = -(x + 1) for x >= 0, and ~x = |x| - 1 for x < 0
+    if (_infP.is_negative())
+    {
+        return infPrecision_detail::from_limbs(infPrecision_detail::sub_limbs(limbs, {1}), false);
+    }
+    return infPrecision_detail::from_limbs(infPrecision_detail::add_limbs(limbs, {1}), true);
+}
+
+/**
+ * @brief Calculate the quotient and the remainder of dividing the first
+ * infPrecision object by the second infPrecision object. The quotient is
+ * truncated toward 0 and the remainder has the same sign as the dividend,
+ * as the built-in integer division does.
+ *
+ * @param _infP1 The dividend
+ * @param _infP2 The divisor
+ * @return pair<infPrecision, infPrecision> The quotient and the remainder
+ */
+pair<infPrecision, infPrecision> divmod(const infPrecision &_infP1, const infPrecision &_infP2)
+{
+    INFPRECISION_STATS_BEGIN();
+    vector<uint32_t> u = infPrecision_detail::to_limbs(_infP1);
+    vector<uint32_t> v = infPrecision_detail::to_limbs(_infP2);
+    if (infPrecision_detail::is_zero_limbs(v))
+    {
+        throw infPrecision::cannot_divideZero();
+    }
+    vector<uint32_t> q, r;
+    infPrecision_detail::divmod_limbs(u, v, q, r);
+
+    bool neg_quotient = _infP1.is_negative() != _infP2.is_negative();
+    pair<infPrecision, infPrecision> result = make_pair(infPrecision_detail::from_limbs(q, neg_quotient),
+                                                        infPrecision_detail::from_limbs(r, _infP1.is_negative()));
+    INFPRECISION_STATS_END(STATS_DIVMOD, max(_infP1.num_digits(), _infP2.num_digits()));
+    return result;
+}
+
+/**
+ * @brief Calculate the modular power (_base ^ _exp) mod _mod without
+ * building the full power
+ *
+ * @param _base The base
+ * @param _exp The exponent, must be non-negative
+ * @param _mod The modulus, must not be 0
+ * @return infPrecision The result in the range [0, |_mod|)
+ */
+infPrecision powmod(const infPrecision &_base, const infPrecision &_exp, const infPrecision &_mod)
+{
+    INFPRECISION_STATS_BEGIN();
+    if (_exp.is_negative())
+    {
+        throw infPrecision::cannot_negExponent();
+    }
+    vector<uint32_t> m = infPrecision_detail::to_limbs(_mod);
+    if (infPrecision_detail::is_zero_limbs(m))
+    {
+        throw infPrecision::cannot_divideZero();
+    }
+    vector<uint32_t> e = infPrecision_detail::to_limbs(_exp);
+    vector<uint32_t> result = infPrecision_detail::powmod_limbs(
+        infPrecision_detail::to_limbs(_base), e, m);
+
+    // A negative base with an odd exponent leaves a negative residue
+    if (_base.is_negative() && (e[0] % 2 == 1) && !infPrecision_detail::is_zero_limbs(result))
+    {
+        result = infPrecision_detail::sub_limbs(m, result);
+    }
+    INFPRECISION_STATS_END(STATS_POWMOD, _mod.num_digits());
+    return infPrecision_detail::from_limbs(result, false);
+}
+
+/**
+ * @brief Hash of infPrecision objects for unordered containers. The stored
+ * digits are hashed in place, so a lookup does not allocate.
+ *
+ */
+namespace std
+{
+    template <>
+    struct hash<infPrecision>
+    {
+        size_t operator()(const infPrecision &_infP) const noexcept
+        {
+            const vector<int64_t> &digits = _infP.digits();
+            return infPrecision_detail::hash_digits(digits.data(), digits.size());
+        }
+    };
+}
+
+#endif
@@ -0,0 +1,445 @@
+/**
+ * @file infPrime.hpp
+ * @brief Probabilistic primality testing and prime generation for
+ * infinite precision integers.
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2022
+ *
+ */
+
+#ifndef INFPRIME_HPP
+#define INFPRIME_HPP
+
+#include <random>
+#include "infPrecision.hpp"
+
+// Forward declaration
+bool is_probable_prime(const infPrecision &_infP, uint64_t _rounds = 25);
+infPrecision next_prime(const infPrecision &_infP, uint64_t _rounds = 25);
+
+namespace infPrecision_detail
+{
+    const uint32_t SMALL_PRIME_LIMIT = 2000; // trial division bound
+    const uint64_t PRIME_WINDOW = 4096;      // odd candidates sieved at once
+    const uint64_t PRIME_ROUNDS = 25;        // Miller-Rabin rounds when 0 is given
+
+    /**
+     * @brief Get all primes not greater than _n by a sieve of Eratosthenes
+     *
+     * @param _n The upper bound
+     * @return vector<uint32_t> The primes in increasing order
+     */
+    vector<uint32_t> primes_up_to(uint32_t _n)
+    {
+        vector<bool> composite((uint64_t)_n + 1, false);
+        vector<uint32_t> table;
+        for (uint64_t i = 2; i <= _n; i++)
+        {
+            if (composite[i])
+            {
+                continue;
+            }
+            table.push_back(i);
+            for (uint64_t j = i * i; j <= _n; j += i)
+            {
+                composite[j] = true;
+            }
+        }
+        return table;
+    }
+
+    /**
+     * @brief Get the table of all primes below SMALL_PRIME_LIMIT. The table is
+     * built once, and it is read-only afterwards, so it can be shared by
+     * every thread.
+     *
+     * @return const vector<uint32_t>& The small primes in increasing order
+     */
+    const vector<uint32_t> &small_primes()
+    {
+        static const vector<uint32_t> primes = primes_up_to(SMALL_PRIME_LIMIT - 1);
+        return primes;
+    }
+
+    /**
+     * @brief Calculate a magnitude modulo a single limb without changing it
+     *
+     */
+    uint32_t mod_small_limbs(const vector<uint32_t> &_a, uint32_t _d)
+    {
+        uint64_t rem = 0;
+        for (uint64_t i = _a.size(); i-- > 0;)
+        {
+            rem = (rem * LIMB_BASE + _a[i]) % _d;
+        }
+        return rem;
+    }
+
+    /**
+     * @brief Miller-Rabin test of an odd magnitude _n > SMALL_PRIME_LIMIT with
+     * a single base, 1 < _base < _n - 1
+     *
+     * @return bool Return false if _base proves that _n is composite, true if
+     * _n is a strong probable prime to _base
+     */
+    bool strong_probable_prime_limbs(const vector<uint32_t> &_n, const vector<uint32_t> &_base)
+    {
+        // Write n - 1 = d * 2^s with d odd
+        vector<uint32_t> one = {1};
+        vector<uint32_t> n_minus_1 = sub_limbs(_n, one);
+        vector<uint32_t> d = n_minus_1;
+        uint64_t s = 0;
+        while (d[0] % 2 == 0)
+        {
+            divmod_small_limbs(d, 2);
+            s++;
+        }
+
+        vector<uint32_t> x = powmod_limbs(_base, d, _n);
+        if (compare_limbs(x, one) == 0 || compare_limbs(x, n_minus_1) == 0)
+        {
+            return true;
+        }
+        for (uint64_t r = 1; r < s; r++)
+        {
+            x = mulmod_limbs(x, x, _n);
+            if (compare_limbs(x, n_minus_1) == 0)
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /**
+     * @brief Calculate the Jacobi symbol (_a / _n) of small integers, where _n
+     * is odd and positive
+     *
+     * @return int Return -1, 0 or 1
+     */
+    int jacobi_small(uint64_t _a, uint64_t _n)
+    {
+        int result = 1;
+        _a %= _n;
+        while (_a != 0)
+        {
+            while (_a % 2 == 0)
+            {
+                _a /= 2;
+                if (_n % 8 == 3 || _n % 8 == 5)
+                {
+                    result = -result;
+                }
+            }
+            swap(_a, _n);
+            if (_a % 4 == 3 && _n % 4 == 3)
+            {
+                result = -result;
+            }
+            _a %= _n;
+        }
+        return _n == 1 ? result : 0;
+    }
+
+    /**
+     * @brief Test if a magnitude is a perfect square by Newton's method for the
+     * integer square root
+     *
+     */
+    bool is_square_limbs(const vector<uint32_t> &_n)
+    {
+        // Start above the root, at 10^(9 * ceil(size / 2)), then every step
+        // decreases x until it reaches floor(sqrt(_n))
+        vector<uint32_t> x((_n.size() + 1) / 2 + 1, 0);
+        x.back() = 1;
+        while (true)
+        {
+            vector<uint32_t> q, r;
+            divmod_limbs(_n, x, q, r);
+            vector<uint32_t> y = add_limbs(x, q);
+            divmod_small_limbs(y, 2);
+            if (compare_limbs(y, x) >= 0)
+            {
+                break;
+            }
+            x = y;
+        }
+        return compare_limbs(mul_limbs(x, x), _n) == 0;
+    }
+
+    /**
+     * @brief Calculate (_a + _b) mod _n on magnitudes smaller than _n
+     *
+     */
+    vector<uint32_t> addmod_limbs(const vector<uint32_t> &_a, const vector<uint32_t> &_b,
+                                  const vector<uint32_t> &_n)
+    {
+        vector<uint32_t> sum = add_limbs(_a, _b);
+        return compare_limbs(sum, _n) >= 0 ? sub_limbs(sum, _n) : sum;
+    }
+
+    /**
+     * @brief Calculate (_a - _b) mod _n on magnitudes smaller than _n
+     *
+     */
+    vector<uint32_t> submod_limbs(const vector<uint32_t> &_a, const vector<uint32_t> &_b,
+                                  const vector<uint32_t> &_n)
+    {
+        return compare_limbs(_a, _b) >= 0 ? sub_limbs(_a, _b) : sub_limbs(add_limbs(_a, _n), _b);
+    }
+
+    /**
+     * @brief Calculate _a / 2 mod _n on a magnitude smaller than the odd _n
+     *
+     */
+    vector<uint32_t> halfmod_limbs(const vector<uint32_t> &_a, const vector<uint32_t> &_n)
+    {
+        vector<uint32_t> half = _a[0] % 2 == 0 ? _a : add_limbs(_a, _n);
+        divmod_small_limbs(half, 2);
+        trim_limbs(half);
+        return half;
+    }
+
+    /**
+     * @brief Strong Lucas test of an odd magnitude _n > SMALL_PRIME_LIMIT, with
+     * the parameters of Selfridge: D is the first of 5, -7, 9, -11, ... with
+     * (D / _n) = -1, P = 1 and Q = (1 - D) / 4. Write _n + 1 = d * 2^s with d
+     * odd; _n passes if U(d) = 0 or V(d * 2^r) = 0 (mod _n) for some r < s.
+     *
+     * @return bool Return false if _n is composite, true if _n is a strong
+     * Lucas probable prime
+     */
+    bool strong_lucas_limbs(const vector<uint32_t> &_n)
+    {
+        // Find D. No D exists for a square, so test that after a few tries
+        int64_t D = 5;
+        for (uint64_t tries = 0;; tries++)
+        {
+            uint64_t a = D > 0 ? D : -D;
+            // (D / n) = (n / |D|) by reciprocity, with the sign flipped if
+            // n = 3 (mod 4) and exactly one of D < 0 and |D| = 3 (mod 4)
+            // holds. The limb base is a multiple of 4, so n mod 4 is the
+            // lowest limb mod 4.
+            int jacobi = jacobi_small(mod_small_limbs(_n, a), a);
+            if ((_n[0] % 4 == 3) && ((D < 0) != (a % 4 == 3)))
+            {
+                jacobi = -jacobi;
+            }
+            if (jacobi == -1)
+            {
+                break;
+            }
+            if (jacobi == 0)
+            {
+                return false; // |D| < _n shares a factor with _n
+            }
+            if (tries == 8 && is_square_limbs(_n))
+            {
+                return false;
+            }
+            D = D > 0 ? -(D + 2) : -D + 2;
+        }
+
+        // D and Q as residues mod n
+        int64_t Q = (1 - D) / 4;
+        vector<uint32_t> d_mod = D > 0 ? small_to_limbs(D) : sub_limbs(_n, small_to_limbs(-D));
+        vector<uint32_t> q_mod = Q > 0 ? small_to_limbs(Q) : sub_limbs(_n, small_to_limbs(-Q));
+
+        // The bits of n + 1 from the most significant one down to bit s,
+        // which are the bits of d
+        vector<uint32_t> words = limbs_to_words(add_limbs(_n, {1}));
+        uint64_t s = 0;
+        while (((words[s / 32] >> (s % 32)) & 1) == 0)
+        {
+            s++;
+        }
+        uint64_t top = bit_length_words(words) - 1;
+
+        // U(1) = 1, V(1) = P = 1, then double k for every bit and add 1 for
+        // every set bit: U(2k) = U(k) V(k), V(2k) = V(k)^2 - 2 Q^k,
+        // U(k + 1) = (U(k) + V(k)) / 2, V(k + 1) = (D U(k) + V(k)) / 2
+        vector<uint32_t> U = {1}, V = {1}, Qk = q_mod;
+        for (uint64_t bit = top; bit-- > s;)
+        {
+            U = mulmod_limbs(U, V, _n);
+            V = submod_limbs(mulmod_limbs(V, V, _n), addmod_limbs(Qk, Qk, _n), _n);
+            Qk = mulmod_limbs(Qk, Qk, _n);
+            if ((words[bit / 32] >> (bit % 32)) & 1)
+            {
+                vector<uint32_t> next_U = halfmod_limbs(addmod_limbs(U, V, _n), _n);
+                V = halfmod_limbs(addmod_limbs(mulmod_limbs(d_mod, U, _n), V, _n), _n);
+                U = next_U;
+                Qk = mulmod_limbs(Qk, q_mod, _n);
+            }
+        }
+
+        if (is_zero_limbs(U) || is_zero_limbs(V))
+        {
+            return true;
+        }
+        for (uint64_t r = 1; r < s; r++)
+        {
+            V = submod_limbs(mulmod_limbs(V, V, _n), addmod_limbs(Qk, Qk, _n), _n);
+            Qk = mulmod_limbs(Qk, Qk, _n);
+            if (is_zero_limbs(V))
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /**
+     * @brief Baillie-PSW test of an odd magnitude _n > SMALL_PRIME_LIMIT: the
+     * Miller-Rabin test with base 2 and the strong Lucas test, which no known
+     * composite passes. Then _rounds - 1 more Miller-Rabin rounds run with
+     * bases drawn from a generator seeded by _n, so the bases cannot be
+     * known in advance like a fixed list of primes, and the answer is still
+     * deterministic.
+     *
+     * @return bool Return false if _n is composite, true if _n is probably prime
+     */
+    bool baillie_psw_limbs(const vector<uint32_t> &_n, uint64_t _rounds)
+    {
+        if (!strong_probable_prime_limbs(_n, {2}) || !strong_lucas_limbs(_n))
+        {
+            return false;
+        }
+
+        uint64_t seed = 0;
+        for (uint32_t limb : _n)
+        {
+            seed = seed * 0x9e3779b97f4a7c15 + limb;
+        }
+        mt19937_64 generator(seed);
+        vector<uint32_t> span = sub_limbs(_n, {4});
+        for (uint64_t k = 1; k < _rounds; k++)
+        {
+            // A base in [3, n - 2]
+            vector<uint32_t> random(_n.size() + 1);
+            for (uint32_t &limb : random)
+            {
+                limb = generator() % LIMB_BASE;
+            }
+            trim_limbs(random);
+            vector<uint32_t> q, base;
+            divmod_limbs(random, span, q, base);
+            if (!strong_probable_prime_limbs(_n, add_limbs(base, {3})))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /**
+     * @brief Test a magnitude by trial division with the small primes
+     *
+     * @return int Return 1 if _n is a small prime, 0 if _n has a small
+     * factor, -1 if the test is inconclusive
+     */
+    int trial_division_limbs(const vector<uint32_t> &_n)
+    {
+        const vector<uint32_t> &primes = small_primes();
+        if (_n.size() == 1 && _n[0] < SMALL_PRIME_LIMIT)
+        {
+            return binary_search(primes.begin(), primes.end(), _n[0]) ? 1 : 0;
+        }
+        for (uint32_t p : primes)
+        {
+            if (mod_small_limbs(_n, p) == 0)
+            {
+                return 0;
+            }
+        }
+        return -1;
+    }
+}
+
+/**
+ * @brief Test if a infPrecision object is a probable prime. Small factors
+ * are eliminated by trial division, then the Baillie-PSW test runs, followed
+ * by _rounds - 1 more Miller-Rabin rounds with bases derived from the
+ * integer. The function has no shared mutable state, so many candidates can
+ * be tested in parallel.
+ *
+ * @param _infP The integer to be tested
+ * @param _rounds The number of Miller-Rabin rounds, 0 for the default 25
+ * @return bool Return false if the integer is composite (or smaller than 2),
+ * true if it is probably prime
+ */
+bool is_probable_prime(const infPrecision &_infP, uint64_t _rounds)
+{
+    if (_infP.is_negative())
+    {
+        return false;
+    }
+    vector<uint32_t> n = infPrecision_detail::to_limbs(_infP);
+    int trial = infPrecision_detail::trial_division_limbs(n);
+    if (trial != -1)
+    {
+        return trial == 1;
+    }
+    return infPrecision_detail::baillie_psw_limbs(n, _rounds == 0 ? infPrecision_detail::PRIME_ROUNDS : _rounds);
+}
+
+/**
+ * @brief Find the smallest probable prime greater than a infPrecision object.
+ * Candidates are eliminated in windows of odd numbers by sieving with the
+ * small primes, so only the survivors run the test of is_probable_prime.
+ *
+ * @param _infP The starting integer
+ * @param _rounds The number of Miller-Rabin rounds, 0 for the default 25
+ * @return infPrecision The next probable prime
+ */
+infPrecision next_prime(const infPrecision &_infP, uint64_t _rounds)
+{
+    using namespace infPrecision_detail;
+    const vector<uint32_t> &primes = small_primes();
+    uint64_t rounds = _rounds == 0 ? PRIME_ROUNDS : _rounds;
+
+    // Every prime in the small table is found by a lookup
+    vector<uint32_t> start = to_limbs(_infP);
+    if (_infP.is_negative() || (start.size() == 1 && start[0] < primes.back()))
+    {
+        uint32_t from = _infP.is_negative() ? 0 : start[0];
+        return from_limbs({*upper_bound(primes.begin(), primes.end(), from)}, false);
+    }
+
+    // The first odd candidate greater than the input
+    vector<uint32_t> base = add_limbs(start, {start[0] % 2 == 0 ? 1u : 2u});
+    while (true)
+    {
+        // composite[i] marks if base + 2i has a small factor
+        vector<bool> composite(PRIME_WINDOW, false);
+        for (uint64_t k = 1; k < primes.size(); k++)
+        {
+            uint64_t p = primes[k];
+            uint64_t r = mod_small_limbs(base, p);
+            // Smallest i with base + 2i = 0 (mod p), 2 is inverted as (p + 1) / 2
+            uint64_t i = r == 0 ? 0 : (p - r) * ((p + 1) / 2) % p;
+            for (; i < PRIME_WINDOW; i += p)
+            {
+                composite[i] = true;
+            }
+        }
+
+        for (uint64_t i = 0; i < PRIME_WINDOW; i++)
+        {
+            if (composite[i])
+            {
+                continue;
+            }
+            vector<uint32_t> candidate = add_limbs(base, {(uint32_t)(2 * i)});
+            if (baillie_psw_limbs(candidate, rounds))
+            {
+                return from_limbs(candidate, false);
+            }
+        }
+        base = add_limbs(base, {(uint32_t)(2 * PRIME_WINDOW)});
+    }
+}
+
+#endif
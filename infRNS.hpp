@@ -0,0 +1,435 @@
+/**
+ * @file infRNS.hpp
+ * @brief Construct a residue number system for infinite precision integers:
+ * an integer is held by its residues modulo a basis of word-sized primes,
+ * so addition, subtraction and multiplication have no carries at all.
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2022
+ *
+ */
+
+#ifndef INFRNS_HPP
+#define INFRNS_HPP
+
+#include "infPrecision.hpp"
+#include "infReduce.hpp"
+#include <memory>
+
+namespace infPrecision_detail
+{
+    /**
+     * @brief Reduce _x < 2^62 modulo a prime 2^30 < _m < 2^31 by Barrett's
+     * method with _mu = floor(2^62 / _m). Every product fits in 64 bits, so
+     * loops over many moduli vectorize.
+     *
+     */
+    INFPRECISION_ALWAYS_INLINE uint32_t rns_reduce(uint64_t _x, uint32_t _m, uint32_t _mu)
+    {
+        uint64_t q = ((_x >> 30) * _mu) >> 32; // at most 2 below floor(_x / _m)
+        uint64_t r = _x - q * _m;
+        r -= r >= _m ? _m : 0;
+        r -= r >= _m ? _m : 0;
+        return r;
+    }
+
+    /**
+     * @brief Calculate _b^_e modulo a prime of the basis
+     *
+     */
+    uint32_t rns_pow(uint32_t _b, uint64_t _e, uint32_t _m, uint32_t _mu)
+    {
+        uint32_t result = 1;
+        for (; _e > 0; _e >>= 1)
+        {
+            if (_e & 1)
+            {
+                result = rns_reduce((uint64_t)result * _b, _m, _mu);
+            }
+            _b = rns_reduce((uint64_t)_b * _b, _m, _mu);
+        }
+        return result;
+    }
+
+    /**
+     * @brief Multiply the moduli [_first, _last) modulo _m. Four running
+     * products in separate variables let the reductions overlap. All moduli
+     * are in (2^30, 2^31), so a modulus needs at most one subtraction to be
+     * reduced modulo another.
+     *
+     */
+    uint32_t rns_product(const uint32_t *_moduli, uint64_t _first, uint64_t _last, uint32_t _m, uint32_t _mu)
+    {
+        uint64_t p0 = 1, p1 = 1, p2 = 1, p3 = 1;
+        uint64_t j = _first;
+        for (; j + 4 <= _last; j += 4)
+        {
+            p0 = rns_reduce(p0 * (_moduli[j] >= _m ? _moduli[j] - _m : _moduli[j]), _m, _mu);
+            p1 = rns_reduce(p1 * (_moduli[j + 1] >= _m ? _moduli[j + 1] - _m : _moduli[j + 1]), _m, _mu);
+            p2 = rns_reduce(p2 * (_moduli[j + 2] >= _m ? _moduli[j + 2] - _m : _moduli[j + 2]), _m, _mu);
+            p3 = rns_reduce(p3 * (_moduli[j + 3] >= _m ? _moduli[j + 3] - _m : _moduli[j + 3]), _m, _mu);
+        }
+        for (; j < _last; j++)
+        {
+            p0 = rns_reduce(p0 * (_moduli[j] >= _m ? _moduli[j] - _m : _moduli[j]), _m, _mu);
+        }
+        return rns_reduce(rns_reduce(p0 * p1, _m, _mu) * (uint64_t)rns_reduce(p2 * p3, _m, _mu), _m, _mu);
+    }
+
+    /**
+     * @brief Test a 32-bit integer for primality by Miller-Rabin with the
+     * bases 2, 7 and 61, which is exact below 4.7 * 10^9
+     *
+     */
+    bool rns_is_prime(uint32_t _n)
+    {
+        if (_n < 2 || _n % 2 == 0)
+        {
+            return _n == 2;
+        }
+        uint32_t d = _n - 1;
+        int s = 0;
+        for (; d % 2 == 0; d /= 2)
+        {
+            s++;
+        }
+        for (uint64_t a : {2, 7, 61})
+        {
+            if (a % _n == 0)
+            {
+                continue;
+            }
+            uint64_t x = 1, b = a;
+            for (uint32_t e = d; e > 0; e >>= 1)
+            {
+                if (e & 1)
+                {
+                    x = x * b % _n;
+                }
+                b = b * b % _n;
+            }
+            bool witness = x != 1 && x != _n - 1;
+            for (int i = 1; i < s && witness; i++)
+            {
+                x = x * x % _n;
+                witness = x != _n - 1;
+            }
+            if (witness)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+}
+
+/**
+ * @brief Construct the basis of a residue number system: the largest primes
+ * below 2^31, enough for their product M to exceed 2 * 10^digits, and the
+ * precomputed data of the Chinese remainder theorem. A basis is read-only
+ * once built, so one basis can be shared by many integers and threads.
+ *
+ */
+class infRNSBasis
+{
+private:
+    vector<uint32_t> moduli;  // the primes
+    vector<uint32_t> mu;      // Barrett factors floor(2^62 / m)
+    vector<uint32_t> inverse; // (M / m)^-1 modulo m
+    // Product tree of the moduli in limbs, tree[0] holds the moduli
+    // themselves and the last level holds M
+    vector<vector<vector<uint32_t>>> tree;
+    uint64_t digits;
+
+    friend class infRNS;
+
+public:
+    /**
+     * @brief Construct a new infRNSBasis object for integers of less than
+     * _digits digits. Computing the inverses takes time quadratic in the
+     * number of primes, so the basis should be built once and reused.
+     *
+     * @param _digits Every result must have less than _digits digits
+     * @param _threads The number of threads, all hardware threads for 0
+     */
+    explicit infRNSBasis(uint64_t _digits, unsigned _threads = 1) : digits(_digits)
+    {
+        using namespace infPrecision_detail;
+        // Every prime is above 2^30, so k primes give M > 2^(30k) > 2 * 10^digits
+        uint64_t count = (uint64_t)((_digits * 3.3219280948873623 + 1) / 30) + 1;
+        for (uint32_t n = 0x7FFFFFFF; moduli.size() < count; n -= 2)
+        {
+            if (rns_is_prime(n))
+            {
+                moduli.push_back(n);
+                mu.push_back((uint64_t(1) << 62) / n);
+            }
+        }
+
+        // (M / m_i) modulo m_i is the product of all other moduli
+        unsigned threads = reduce_threads(_threads);
+        inverse.resize(count);
+        parallel_for(count, threads, [&](uint64_t _i)
+                     {
+                         uint32_t m = moduli[_i], factor = mu[_i];
+                         uint32_t product = rns_reduce((uint64_t)rns_product(moduli.data(), 0, _i, m, factor) *
+                                                           rns_product(moduli.data(), _i + 1, count, m, factor),
+                                                       m, factor);
+                         // Fermat's little theorem, as m_i is prime
+                         inverse[_i] = rns_pow(product, m - 2, m, factor); });
+
+        tree.push_back({});
+        for (uint32_t m : moduli)
+        {
+            tree[0].push_back(small_to_limbs(m));
+        }
+        while (tree.back().size() > 1)
+        {
+            const vector<vector<uint32_t>> &below = tree.back();
+            vector<vector<uint32_t>> level((below.size() + 1) / 2);
+            parallel_for(below.size() / 2, threads, [&](uint64_t _j)
+                         { level[_j] = mul_limbs(below[2 * _j], below[2 * _j + 1]); });
+            if (below.size() % 2 == 1)
+            {
+                level.back() = below.back();
+            }
+            tree.push_back(std::move(level));
+        }
+    }
+
+    /**
+     * @brief Get the number of primes in the basis
+     *
+     */
+    uint64_t size() const
+    {
+        return moduli.size();
+    }
+
+    /**
+     * @brief Get the number of digits the results must stay below
+     *
+     */
+    uint64_t capacity() const
+    {
+        return digits;
+    }
+};
+
+/**
+ * @brief Construct the class of integers in a residue number system. Every
+ * operation works on each prime independently, without carries, so the
+ * loops vectorize and any number of operations can run in parallel. The
+ * results wrap around modulo M: they are exact as long as the absolute
+ * value of every final result stays below 10^digits of the basis.
+ *
+ */
+class infRNS
+{
+private:
+    shared_ptr<const infRNSBasis> basis;
+    vector<uint32_t> residues;
+
+    /**
+     * @brief Throw if two operands do not share their basis
+     *
+     */
+    static void check_basis(const infRNS &_a, const infRNS &_b)
+    {
+        if (_a.basis != _b.basis)
+        {
+            throw different_basis();
+        }
+    }
+
+public:
+    /**
+     * @brief Construct a new infRNS object by a infPrecision object. The
+     * integer is reduced modulo every prime by Horner's rule on its limbs.
+     *
+     * @param _infP A infPrecision object
+     * @param _basis The shared basis
+     * @param _threads The number of threads, all hardware threads for 0
+     */
+    infRNS(const infPrecision &_infP, shared_ptr<const infRNSBasis> _basis, unsigned _threads = 1)
+        : basis(std::move(_basis)), residues(basis->size())
+    {
+        using namespace infPrecision_detail;
+        vector<uint32_t> limbs = to_limbs(_infP);
+        bool negative = _infP.is_negative();
+        parallel_for(residues.size(), reduce_threads(_threads), [&](uint64_t _i)
+                     {
+                         uint32_t m = basis->moduli[_i], factor = basis->mu[_i];
+                         uint32_t r = 0;
+                         for (uint64_t j = limbs.size(); j-- > 0;)
+                         {
+                             r = rns_reduce((uint64_t)r * LIMB_BASE + limbs[j], m, factor);
+                         }
+                         residues[_i] = negative && r != 0 ? m - r : r; });
+    }
+
+    /**
+     * @brief Convert back to a infPrecision object by the Chinese remainder
+     * theorem. The terms c_i * M / m_i are summed up the product tree of the
+     * basis, joining two halves by v = vl * Mr + vr * Ml, so the
+     * multiplications have balanced operands; the sum is reduced modulo M
+     * once at the end and mapped into (-M/2, M/2].
+     *
+     * @param _threads The number of threads, all hardware threads for 0
+     * @return infPrecision The integer
+     */
+    infPrecision to_infPrecision(unsigned _threads = 1) const
+    {
+        using namespace infPrecision_detail;
+        const vector<vector<vector<uint32_t>>> &tree = basis->tree;
+        unsigned threads = reduce_threads(_threads);
+        vector<vector<uint32_t>> level(residues.size());
+        for (uint64_t i = 0; i < residues.size(); i++)
+        {
+            uint32_t m = basis->moduli[i];
+            level[i] = small_to_limbs(rns_reduce((uint64_t)residues[i] * basis->inverse[i], m, basis->mu[i]));
+        }
+        for (uint64_t l = 0; level.size() > 1; l++)
+        {
+            vector<vector<uint32_t>> next((level.size() + 1) / 2);
+            parallel_for(level.size() / 2, threads, [&](uint64_t _j)
+                         {
+                             vector<uint32_t> sum = add_limbs(mul_limbs(level[2 * _j], tree[l][2 * _j + 1]),
+                                                              mul_limbs(level[2 * _j + 1], tree[l][2 * _j]));
+                             trim_limbs(sum);
+                             next[_j] = std::move(sum); });
+            if (level.size() % 2 == 1)
+            {
+                next.back() = std::move(level.back());
+            }
+            level = std::move(next);
+        }
+
+        // The sum is below k * M, so the quotient is small
+        const vector<uint32_t> &modulus = tree.back()[0];
+        vector<uint32_t> quotient, value;
+        divmod_limbs(level[0], modulus, quotient, value);
+        // Residues above M / 2 stand for negative integers
+        vector<uint32_t> complement = sub_limbs(modulus, value);
+        if (compare_limbs(value, complement) > 0)
+        {
+            return from_limbs(complement, true);
+        }
+        return from_limbs(value, false);
+    }
+
+    /**
+     * @brief Get the shared basis
+     *
+     */
+    const shared_ptr<const infRNSBasis> &get_basis() const
+    {
+        return basis;
+    }
+
+    /**
+     * @brief Add another infRNS object with the same basis
+     *
+     */
+    infRNS &operator+=(const infRNS &_infR)
+    {
+        check_basis(*this, _infR);
+        const uint32_t *moduli = basis->moduli.data();
+        for (uint64_t i = 0; i < residues.size(); i++)
+        {
+            uint32_t r = residues[i] + _infR.residues[i];
+            residues[i] = r >= moduli[i] ? r - moduli[i] : r;
+        }
+        return *this;
+    }
+
+    /**
+     * @brief Subtract another infRNS object with the same basis
+     *
+     */
+    infRNS &operator-=(const infRNS &_infR)
+    {
+        check_basis(*this, _infR);
+        const uint32_t *moduli = basis->moduli.data();
+        for (uint64_t i = 0; i < residues.size(); i++)
+        {
+            uint32_t r = residues[i] + moduli[i] - _infR.residues[i];
+            residues[i] = r >= moduli[i] ? r - moduli[i] : r;
+        }
+        return *this;
+    }
+
+    /**
+     * @brief Multiply by another infRNS object with the same basis
+     *
+     */
+    infRNS &operator*=(const infRNS &_infR)
+    {
+        check_basis(*this, _infR);
+        const uint32_t *moduli = basis->moduli.data();
+        const uint32_t *mu = basis->mu.data();
+        for (uint64_t i = 0; i < residues.size(); i++)
+        {
+            residues[i] = infPrecision_detail::rns_reduce((uint64_t)residues[i] * _infR.residues[i], moduli[i], mu[i]);
+        }
+        return *this;
+    }
+
+    /**
+     * @brief Negate the integer
+     *
+     */
+    infRNS operator-() const
+    {
+        infRNS result = *this;
+        for (uint64_t i = 0; i < residues.size(); i++)
+        {
+            result.residues[i] = residues[i] == 0 ? 0 : basis->moduli[i] - residues[i];
+        }
+        return result;
+    }
+
+    /**
+     * @brief Exception occurs when the operands of an operation have
+     * different bases
+     *
+     */
+    class different_basis : public invalid_argument
+    {
+    public:
+        different_basis() : invalid_argument("Cannot mix integers of different bases!"){};
+    };
+};
+
+/**
+ * @brief Overloaded binary operator + to calculate the summation of two
+ * infRNS objects, one carry-free addition per prime
+ *
+ */
+infRNS operator+(infRNS _infR1, const infRNS &_infR2)
+{
+    return _infR1 += _infR2;
+}
+
+/**
+ * @brief Overloaded binary operator - to calculate the subtraction of two
+ * infRNS objects, one carry-free subtraction per prime
+ *
+ */
+infRNS operator-(infRNS _infR1, const infRNS &_infR2)
+{
+    return _infR1 -= _infR2;
+}
+
+/**
+ * @brief Overloaded binary operator * to calculate the multiplication of
+ * two infRNS objects, one modular multiplication per prime
+ *
+ */
+infRNS operator*(infRNS _infR1, const infRNS &_infR2)
+{
+    return _infR1 *= _infR2;
+}
+
+#endif
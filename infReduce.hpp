@@ -0,0 +1,430 @@
+/**
+ * @file infReduce.hpp
+ * @brief Sum and product of many infinite precision integers by balanced
+ * reductions, which run in parallel on a shared pool of threads.
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2022
+ *
+ */
+
+#ifndef INFREDUCE_HPP
+#define INFREDUCE_HPP
+
+#include "infPrecision.hpp"
+#include "infAccumulator.hpp"
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+
+// Forward declaration
+template <class Iterator>
+infPrecision sum(Iterator _first, Iterator _last, unsigned _threads = 0);
+template <class Range>
+infPrecision sum(const Range &_range, unsigned _threads = 0);
+template <class Iterator>
+infPrecision product(Iterator _first, Iterator _last, unsigned _threads = 0);
+template <class Range>
+infPrecision product(const Range &_range, unsigned _threads = 0);
+
+namespace infPrecision_detail
+{
+    /**
+     * @brief Get the number of threads to use, all hardware threads for 0
+     *
+     */
+    unsigned reduce_threads(unsigned _threads)
+    {
+        if (_threads == 0)
+        {
+            _threads = thread::hardware_concurrency();
+        }
+        return max(_threads, 1u);
+    }
+}
+
+/**
+ * @brief Construct a pool of worker threads which run tasks in the order
+ * they are posted. The destructor runs the tasks still queued and joins
+ * the workers.
+ *
+ */
+class infExecutor
+{
+private:
+    mutex lock;
+    condition_variable ready;
+    deque<function<void()>> tasks;
+    vector<thread> workers;
+    bool stopping = false;
+
+    /**
+     * @brief Run queued tasks until the executor stops and the queue is empty
+     *
+     */
+    void work()
+    {
+        for (;;)
+        {
+            function<void()> task;
+            {
+                unique_lock<mutex> guard(lock);
+                ready.wait(guard, [this]()
+                           { return stopping || !tasks.empty(); });
+                if (tasks.empty())
+                {
+                    return;
+                }
+                task = std::move(tasks.front());
+                tasks.pop_front();
+            }
+            task();
+        }
+    }
+
+public:
+    /**
+     * @brief Construct a new infExecutor object and start its workers
+     *
+     * @param _threads The number of worker threads, all hardware threads
+     * for 0
+     */
+    explicit infExecutor(unsigned _threads = 0)
+    {
+        for (unsigned t = 0; t < infPrecision_detail::reduce_threads(_threads); t++)
+        {
+            workers.emplace_back([this]()
+                                 { work(); });
+        }
+    }
+
+    infExecutor(const infExecutor &) = delete;
+    infExecutor &operator=(const infExecutor &) = delete;
+
+    /**
+     * @brief Destroy the infExecutor object after the queued tasks have run
+     *
+     */
+    ~infExecutor()
+    {
+        {
+            lock_guard<mutex> guard(lock);
+            stopping = true;
+        }
+        ready.notify_all();
+        for (thread &worker : workers)
+        {
+            worker.join();
+        }
+    }
+
+    /**
+     * @brief Queue a task, which must not throw
+     *
+     * @param _task The task
+     */
+    void post(function<void()> _task)
+    {
+        {
+            lock_guard<mutex> guard(lock);
+            tasks.push_back(std::move(_task));
+        }
+        ready.notify_one();
+    }
+
+    /**
+     * @brief Get the executor shared by the library, with one worker per
+     * hardware thread, started on first use
+     *
+     */
+    static infExecutor &shared()
+    {
+        static infExecutor executor;
+        return executor;
+    }
+};
+
+namespace infPrecision_detail
+{
+    /**
+     * @brief Shared state of one parallel_for call, which lives until the
+     * last posted helper has run, even after the call has returned
+     *
+     */
+    struct parallel_state
+    {
+        mutex lock;
+        condition_variable finished;
+        unsigned active = 0; // helpers working on the indices
+        bool closed = false; // true once the caller stops waiting for helpers
+        atomic<uint64_t> next{0};
+        atomic<bool> failed{false};
+        exception_ptr error;
+    };
+
+    /**
+     * @brief Call _f(i) for every i in [0, _count) on up to _threads threads:
+     * the calling one and helpers posted to infExecutor::shared(), so no
+     * thread is started per call. The indices are handed out one by one, so
+     * tasks of different sizes are balanced. A helper which only starts
+     * after the caller has finished does nothing, so a call from a worker of
+     * the pool cannot wait for helpers queued behind it. The first exception
+     * thrown by a task is rethrown after all helpers have finished.
+     *
+     */
+    template <class Function>
+    void parallel_for(uint64_t _count, unsigned _threads, const Function &_f)
+    {
+        shared_ptr<parallel_state> state = make_shared<parallel_state>();
+        auto work = [_count, &_f](parallel_state &_state)
+        {
+            for (uint64_t i = _state.next++; i < _count && !_state.failed; i = _state.next++)
+            {
+                try
+                {
+                    _f(i);
+                }
+                catch (...)
+                {
+                    if (!_state.failed.exchange(true))
+                    {
+                        _state.error = current_exception();
+                    }
+                }
+            }
+        };
+        for (uint64_t t = 1; t < min<uint64_t>(_threads, _count); t++)
+        {
+            infExecutor::shared().post([state, work]()
+                                       {
+                                           {
+                                               lock_guard<mutex> guard(state->lock);
+                                               if (state->closed)
+                                               {
+                                                   return;
+                                               }
+                                               state->active++;
+                                           }
+                                           work(*state);
+                                           {
+                                               lock_guard<mutex> guard(state->lock);
+                                               state->active--;
+                                           }
+                                           state->finished.notify_all(); });
+        }
+        work(*state);
+        unique_lock<mutex> guard(state->lock);
+        state->closed = true;
+        state->finished.wait(guard, [&state]()
+                             { return state->active == 0; });
+        if (state->error)
+        {
+            rethrow_exception(state->error);
+        }
+    }
+
+    /**
+     * @brief Collect pointers to the integers of a range whose iterators
+     * refer to infPrecision objects that stay in place
+     *
+     */
+    template <class Iterator>
+    void collect_items(Iterator _first, Iterator _last, vector<const infPrecision *> &_items,
+                       vector<infPrecision> &, true_type)
+    {
+        for (; _first != _last; ++_first)
+        {
+            _items.push_back(&*_first);
+        }
+    }
+
+    /**
+     * @brief Collect the integers of any other range, such as an
+     * istream_iterator, a generator or a range of int64_t, by copying them
+     * into _copies first
+     *
+     */
+    template <class Iterator>
+    void collect_items(Iterator _first, Iterator _last, vector<const infPrecision *> &_items,
+                       vector<infPrecision> &_copies, false_type)
+    {
+        for (; _first != _last; ++_first)
+        {
+            _copies.emplace_back(*_first);
+        }
+        for (const infPrecision &copy : _copies)
+        {
+            _items.push_back(&copy);
+        }
+    }
+
+    /**
+     * @brief Collect pointers to the integers of a range. The integers of a
+     * forward range of infPrecision lvalues are used in place; every other
+     * range is copied into _copies, which must outlive the pointers.
+     *
+     */
+    template <class Iterator>
+    void collect_items(Iterator _first, Iterator _last, vector<const infPrecision *> &_items,
+                       vector<infPrecision> &_copies)
+    {
+        typedef typename iterator_traits<Iterator>::reference reference;
+        typedef typename iterator_traits<Iterator>::iterator_category category;
+        collect_items(_first, _last, _items, _copies,
+                      integral_constant<bool, is_lvalue_reference<reference>::value &&
+                                                  is_same<typename decay<reference>::type, infPrecision>::value &&
+                                                  is_base_of<forward_iterator_tag, category>::value>());
+    }
+
+    /**
+     * @brief Multiply magnitudes level by level. Every level sorts the
+     * operands by size and multiplies neighbours, so both operands of a
+     * multiplication have about the same size and large ones reach the
+     * Karatsuba tier; the multiplications of one level run in parallel. The
+     * order only depends on the sizes and positions, never on the timing.
+     *
+     * @param _level The magnitudes, consumed
+     * @param _threads The number of threads
+     * @return vector<uint32_t> The product, 1 if there is no operand
+     */
+    vector<uint32_t> product_levels(vector<vector<uint32_t>> _level, unsigned _threads)
+    {
+        if (_level.empty())
+        {
+            return {1};
+        }
+        while (_level.size() > 1)
+        {
+            stable_sort(_level.begin(), _level.end(),
+                        [](const vector<uint32_t> &_a, const vector<uint32_t> &_b)
+                        { return _a.size() < _b.size(); });
+            vector<vector<uint32_t>> next((_level.size() + 1) / 2);
+            parallel_for(_level.size() / 2, _threads, [&](uint64_t _i)
+                         {
+                             next[_i] = mul_limbs(_level[2 * _i], _level[2 * _i + 1]);
+                             // Release the operands at once to bound the memory
+                             _level[2 * _i] = vector<uint32_t>();
+                             _level[2 * _i + 1] = vector<uint32_t>(); });
+            if (_level.size() % 2 == 1)
+            {
+                next.back() = std::move(_level.back());
+            }
+            _level = std::move(next);
+        }
+        return std::move(_level[0]);
+    }
+}
+
+/**
+ * @brief Calculate the sum of a range of infPrecision objects. The range is
+ * cut into one chunk per thread; every chunk is added up by an
+ * infAccumulator, in linear time, and the partial sums are added by a
+ * balanced tree.
+ *
+ * @param _first The first integer
+ * @param _last One past the last integer
+ * @param _threads The number of threads, all hardware threads for 0
+ * @return infPrecision The sum, 0 for an empty range
+ */
+template <class Iterator>
+infPrecision sum(Iterator _first, Iterator _last, unsigned _threads)
+{
+    using namespace infPrecision_detail;
+    vector<const infPrecision *> items;
+    vector<infPrecision> copies;
+    collect_items(_first, _last, items, copies);
+    uint64_t chunks = min<uint64_t>(reduce_threads(_threads), max<uint64_t>(items.size(), 1));
+    vector<infPrecision> partial(chunks);
+    parallel_for(chunks, chunks, [&](uint64_t _c)
+                 {
+                     infAccumulator acc;
+                     for (uint64_t i = items.size() * _c / chunks; i < items.size() * (_c + 1) / chunks; i++)
+                     {
+                         acc += *items[i];
+                     }
+                     partial[_c] = acc.value(); });
+
+    // Add the partial sums pairwise, level by level
+    while (partial.size() > 1)
+    {
+        vector<infPrecision> next((partial.size() + 1) / 2);
+        parallel_for(partial.size() / 2, chunks, [&](uint64_t _i)
+                     { next[_i] = partial[2 * _i] + partial[2 * _i + 1]; });
+        if (partial.size() % 2 == 1)
+        {
+            next.back() = std::move(partial.back());
+        }
+        partial = std::move(next);
+    }
+    return partial[0];
+}
+
+/**
+ * @brief Calculate the sum of all infPrecision objects in a container
+ *
+ * @param _range A container of infPrecision objects
+ * @param _threads The number of threads, all hardware threads for 0
+ * @return infPrecision The sum, 0 for an empty container
+ */
+template <class Range>
+infPrecision sum(const Range &_range, unsigned _threads)
+{
+    return sum(begin(_range), end(_range), _threads);
+}
+
+/**
+ * @brief Calculate the product of a range of infPrecision objects by a
+ * balanced product tree, where operands of similar sizes are multiplied
+ * together and every level of the tree runs in parallel
+ *
+ * @param _first The first integer
+ * @param _last One past the last integer
+ * @param _threads The number of threads, all hardware threads for 0
+ * @return infPrecision The product, 1 for an empty range
+ */
+template <class Iterator>
+infPrecision product(Iterator _first, Iterator _last, unsigned _threads)
+{
+    using namespace infPrecision_detail;
+    vector<const infPrecision *> items;
+    vector<infPrecision> copies;
+    collect_items(_first, _last, items, copies);
+    bool negative = false;
+    for (const infPrecision *item : items)
+    {
+        // A factor 0 makes the product 0 without any multiplication
+        if (item->digits()[0] == 0)
+        {
+            return infPrecision();
+        }
+        negative = negative != item->is_negative();
+    }
+    unsigned threads = reduce_threads(_threads);
+    vector<vector<uint32_t>> level(items.size());
+    parallel_for(items.size(), threads, [&](uint64_t _i)
+                 { level[_i] = to_limbs(*items[_i]); });
+    return from_limbs(product_levels(std::move(level), threads), negative);
+}
+
+/**
+ * @brief Calculate the product of all infPrecision objects in a container
+ *
+ * @param _range A container of infPrecision objects
+ * @param _threads The number of threads, all hardware threads for 0
+ * @return infPrecision The product, 1 for an empty container
+ */
+template <class Range>
+infPrecision product(const Range &_range, unsigned _threads)
+{
+    return product(begin(_range), end(_range), _threads);
+}
+
+#endif
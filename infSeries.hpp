@@ -0,0 +1,317 @@
+/**
+ * @file infSeries.hpp
+ * @brief Evaluate hypergeometric-like series of rational terms exactly by
+ * binary splitting, with parallel subtrees and checkpoints for long runs.
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2022
+ *
+ */
+
+#ifndef INFSERIES_HPP
+#define INFSERIES_HPP
+
+#include "infPrecision.hpp"
+#include "infReduce.hpp"
+#include <cstdio>
+#include <fstream>
+#include <functional>
+
+/**
+ * @brief Settings of the evaluation of a series
+ *
+ */
+struct infSeriesOptions
+{
+    unsigned threads = 1;               // threads of the subtrees, 1 for none
+    string checkpoint;                  // checkpoint file, no checkpoint if empty
+    uint64_t checkpoint_terms = 65536;  // terms between two checkpoints
+};
+
+/**
+ * @brief Construct the class of a series
+ *
+ *     S(n1, n2) = sum of a(n) * p(n1) ... p(n) / (q(n1) ... q(n))
+ *
+ * over n1 <= n < n2, where p, q and a are integer terms given by functions.
+ * Binary splitting evaluates the integers P = p(n1) ... p(n2 - 1),
+ * Q = q(n1) ... q(n2 - 1) and T = S(n1, n2) * Q by halving the range
+ * recursively, so the multiplications have balanced operands:
+ *
+ *     P = Pl * Pr, Q = Ql * Qr, T = Tl * Qr + Pl * Tr
+ *
+ * For example, e is the series with p(n) = 1, q(0) = 1, q(n) = n and
+ * a(n) = 1.
+ *
+ */
+class infSeries
+{
+public:
+    typedef function<infPrecision(uint64_t)> generator;
+
+    /**
+     * @brief The integers P, Q and T of a range of terms
+     *
+     */
+    struct sums
+    {
+        infPrecision P, Q, T;
+    };
+
+private:
+    generator p, q, a;
+    infSeriesOptions options;
+
+    /**
+     * @brief Join the sums of two adjacent ranges. The P of the joined
+     * range is only calculated when _need_P is true.
+     *
+     */
+    static sums join(const sums &_left, const sums &_right, bool _need_P)
+    {
+        sums joined;
+        joined.P = _need_P ? _left.P * _right.P : infPrecision(1);
+        joined.Q = _left.Q * _right.Q;
+        joined.T = _left.T * _right.Q + _left.P * _right.T;
+        return joined;
+    }
+
+    /**
+     * @brief Evaluate [_n1, _n2) recursively. The P of a range is only
+     * needed when the range is the left part of a join, so the right spine
+     * of the tree skips it. Up to _threads threads share the subtrees: the
+     * two halves of a range run through parallel_for on the shared pool of
+     * infExecutor, so no thread is started per range.
+     *
+     */
+    sums split(uint64_t _n1, uint64_t _n2, bool _need_P, unsigned _threads) const
+    {
+        sums result;
+        if (_n2 <= _n1)
+        {
+            result.P = infPrecision(1);
+            result.Q = infPrecision(1);
+            result.T = infPrecision();
+            return result;
+        }
+        if (_n2 - _n1 == 1)
+        {
+            result.P = p(_n1);
+            result.Q = q(_n1);
+            result.T = a(_n1) * result.P;
+            return result;
+        }
+        uint64_t mid = _n1 + (_n2 - _n1) / 2;
+        sums left, right;
+        // Small ranges are not worth a thread
+        if (_threads > 1 && _n2 - _n1 >= 64)
+        {
+            unsigned left_threads = _threads / 2;
+            // An exception of a generator in either half is rethrown here
+            infPrecision_detail::parallel_for(2, 2, [&](uint64_t _i)
+                                              {
+                                                  if (_i == 0)
+                                                  {
+                                                      left = split(_n1, mid, true, left_threads);
+                                                  }
+                                                  else
+                                                  {
+                                                      right = split(mid, _n2, _need_P, _threads - left_threads);
+                                                  } });
+        }
+        else
+        {
+            left = split(_n1, mid, true, 1);
+            right = split(mid, _n2, _need_P, 1);
+        }
+        return join(left, right, _need_P);
+    }
+
+    /**
+     * @brief Write the finished blocks to the checkpoint file. The file is
+     * written under a temporary name and renamed, so a crash leaves either
+     * the old or the new checkpoint.
+     *
+     */
+    void save_checkpoint(uint64_t _terms, uint64_t _next, const vector<pair<uint64_t, sums>> &_stack) const
+    {
+        string temporary = options.checkpoint + ".tmp";
+        {
+            ofstream out(temporary, ios::trunc);
+            out << "infSeries " << _terms << " " << options.checkpoint_terms << " " << _next << " " << _stack.size() << "\n";
+            for (const pair<uint64_t, sums> &entry : _stack)
+            {
+                out << entry.first << "\n";
+                write_integer(out, entry.second.P) << "\n";
+                write_integer(out, entry.second.Q) << "\n";
+                write_integer(out, entry.second.T) << "\n";
+            }
+            out.flush();
+            if (!out)
+            {
+                throw bad_checkpoint();
+            }
+        }
+        if (rename(temporary.c_str(), options.checkpoint.c_str()) != 0)
+        {
+            throw bad_checkpoint();
+        }
+    }
+
+    /**
+     * @brief Read the finished blocks from the checkpoint file, if it exists
+     *
+     * @return uint64_t The first term not evaluated yet, 0 without a file
+     */
+    uint64_t load_checkpoint(uint64_t _terms, vector<pair<uint64_t, sums>> &_stack) const
+    {
+        ifstream in(options.checkpoint);
+        if (!in)
+        {
+            return 0;
+        }
+        string magic;
+        uint64_t terms = 0, block = 0, next = 0, count = 0;
+        in >> magic >> terms >> block >> next >> count;
+        // A checkpoint of another evaluation must not be resumed
+        if (!in || magic != "infSeries" || terms != _terms || block != options.checkpoint_terms || next > _terms)
+        {
+            throw bad_checkpoint();
+        }
+        // Only the last block may be partial. The heights of the entries
+        // are the set bits of the number of finished blocks, from the
+        // highest one, so there are at most 64 of them.
+        uint64_t blocks = next / block + (next % block != 0);
+        if ((next % block != 0 && next != _terms) || count > 64)
+        {
+            throw bad_checkpoint();
+        }
+        _stack.resize(count);
+        uint64_t remaining = blocks;
+        for (pair<uint64_t, sums> &entry : _stack)
+        {
+            in >> entry.first >> entry.second.P >> entry.second.Q >> entry.second.T;
+            if (!in || entry.first >= 64 || (remaining >> entry.first) != 1)
+            {
+                throw bad_checkpoint();
+            }
+            remaining -= (uint64_t)1 << entry.first;
+        }
+        if (remaining != 0)
+        {
+            throw bad_checkpoint();
+        }
+        return next;
+    }
+
+public:
+    /**
+     * @brief Construct a new infSeries object by its term generators
+     *
+     * @param _p The numerator factor p(n) of the term ratio
+     * @param _q The denominator factor q(n) of the term ratio
+     * @param _a The coefficient a(n) of every term
+     * @param _options The threads and the checkpoints
+     */
+    infSeries(generator _p, generator _q, generator _a, const infSeriesOptions &_options = infSeriesOptions())
+        : p(std::move(_p)), q(std::move(_q)), a(std::move(_a)), options(_options)
+    {
+    }
+
+    /**
+     * @brief Evaluate the sums of the terms [_n1, _n2) by binary splitting,
+     * without checkpoints
+     *
+     * @param _n1 The first term
+     * @param _n2 One past the last term
+     * @return sums P, Q and T of the range
+     */
+    sums evaluate(uint64_t _n1, uint64_t _n2) const
+    {
+        return split(_n1, _n2, true, max(options.threads, 1u));
+    }
+
+    /**
+     * @brief Evaluate the sums of the first _terms terms. With a checkpoint
+     * file, the terms are evaluated in blocks of checkpoint_terms; the file
+     * is rewritten after every block, and an evaluation started again with
+     * the same file, terms and block size resumes after the last block. The
+     * blocks are joined like a binary counter (two blocks, then two pairs of
+     * blocks, ...), so the joins stay balanced. The file is removed at the
+     * end. P of the result is not calculated and is set to 1.
+     *
+     * @param _terms The number of terms
+     * @return sums P, Q and T of the terms [0, _terms)
+     */
+    sums evaluate(uint64_t _terms) const
+    {
+        unsigned threads = max(options.threads, 1u);
+        if (options.checkpoint.empty() || options.checkpoint_terms == 0)
+        {
+            return split(0, _terms, false, threads);
+        }
+
+        // Every entry is a finished range with its height in the counter
+        vector<pair<uint64_t, sums>> stack;
+        uint64_t next = load_checkpoint(_terms, stack);
+        while (next < _terms)
+        {
+            uint64_t end = min(_terms, next + options.checkpoint_terms);
+            stack.push_back(make_pair(uint64_t(0), split(next, end, true, threads)));
+            while (stack.size() >= 2 && stack[stack.size() - 2].first == stack.back().first)
+            {
+                sums joined = join(stack[stack.size() - 2].second, stack.back().second, true);
+                uint64_t height = stack.back().first + 1;
+                stack.pop_back();
+                stack.back() = make_pair(height, std::move(joined));
+            }
+            next = end;
+            save_checkpoint(_terms, next, stack);
+        }
+
+        // Join the remaining ranges from the right
+        sums result = split(0, 0, false, 1);
+        for (uint64_t i = stack.size(); i-- > 0;)
+        {
+            result = join(stack[i].second, result, false);
+        }
+        remove(options.checkpoint.c_str());
+        return result;
+    }
+
+    /**
+     * @brief Evaluate the first _terms terms as a fixed-point number: the
+     * sum times 10^_digits, rounded toward negative infinity (floor), so the
+     * digits after the point are those of the sum also for a negative sum
+     *
+     * @param _terms The number of terms
+     * @param _digits The number of digits after the decimal point
+     * @return infPrecision floor(sum * 10^_digits)
+     */
+    infPrecision fixed_point(uint64_t _terms, uint64_t _digits) const
+    {
+        sums s = evaluate(_terms);
+        pair<infPrecision, infPrecision> qr = divmod(s.T.mul_pow10(_digits), s.Q);
+        // divmod truncates toward 0, which is one above the floor if the
+        // quotient is negative and inexact
+        if (qr.second.digits()[0] != 0 && qr.second.is_negative() != s.Q.is_negative())
+        {
+            --qr.first;
+        }
+        return qr.first;
+    }
+
+    /**
+     * @brief Exception occurs when a checkpoint file cannot be written, or
+     * belongs to another evaluation, or is damaged
+     *
+     */
+    class bad_checkpoint : public invalid_argument
+    {
+    public:
+        bad_checkpoint() : invalid_argument("Cannot use the checkpoint file!"){};
+    };
+};
+
+#endif
@@ -0,0 +1,181 @@
+/**
+ * @file infStream.hpp
+ * @brief Read and write infinite precision integers through POSIX file
+ * descriptors (files, pipes and sockets) in fixed-size blocks, so no string
+ * or second copy of the whole integer is ever built.
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2022
+ *
+ */
+
+#ifndef INFSTREAM_HPP
+#define INFSTREAM_HPP
+
+#include "infPrecision.hpp"
+#include <cerrno>
+#include <system_error>
+#include <unistd.h>
+#include <sys/stat.h>
+
+// Forward declaration
+infPrecision read_integer_fd(int _fd, uint64_t _block = 65536);
+void write_integer_fd(int _fd, const infPrecision &_infP, uint64_t _block = 65536);
+
+namespace infPrecision_detail
+{
+    /**
+     * @brief Read up to _size bytes from a file descriptor, retrying when a
+     * signal interrupts the call
+     *
+     * @return uint64_t The bytes read, 0 at the end of the file
+     */
+    uint64_t read_block(int _fd, char *_buffer, uint64_t _size)
+    {
+        while (true)
+        {
+            ssize_t n = ::read(_fd, _buffer, _size);
+            if (n >= 0)
+            {
+                return n;
+            }
+            if (errno != EINTR)
+            {
+                throw system_error(errno, generic_category(), "read_integer_fd");
+            }
+        }
+    }
+
+    /**
+     * @brief Write all _size bytes to a file descriptor, continuing after
+     * partial writes and interruptions by signals
+     *
+     */
+    void write_block(int _fd, const char *_buffer, uint64_t _size)
+    {
+        while (_size > 0)
+        {
+            ssize_t n = ::write(_fd, _buffer, _size);
+            if (n < 0 && errno == EINTR)
+            {
+                continue;
+            }
+            if (n < 0)
+            {
+                throw system_error(errno, generic_category(), "write_integer_fd");
+            }
+            _buffer += n;
+            _size -= n;
+        }
+    }
+
+    bool is_space_char(char _c)
+    {
+        return _c == ' ' || _c == '\n' || _c == '\t' || _c == '\r' || _c == '\v' || _c == '\f';
+    }
+}
+
+/**
+ * @brief Read one integer from a file descriptor until its end, _block bytes
+ * at a time. The whole content must be the integer (it may start with '-'),
+ * optionally surrounded by whitespace. For a regular file the digit vector
+ * is allocated once from the file size, so the peak memory is the integer.
+ *
+ * @param _fd An open file descriptor
+ * @param _block The number of bytes read at once
+ * @return infPrecision The integer read
+ */
+infPrecision read_integer_fd(int _fd, uint64_t _block)
+{
+    using namespace infPrecision_detail;
+    vector<int64_t> digits;
+    struct stat info;
+    if (fstat(_fd, &info) == 0 && S_ISREG(info.st_mode))
+    {
+        digits.reserve(info.st_size);
+    }
+
+    // Every byte is either whitespace before the integer, its sign, one of
+    // its digits, or whitespace after it
+    enum
+    {
+        BEFORE,
+        DIGITS,
+        AFTER
+    } state = BEFORE;
+    bool negative = false;
+    vector<char> buffer(max<uint64_t>(_block, 1));
+    for (uint64_t n = read_block(_fd, buffer.data(), buffer.size()); n > 0;
+         n = read_block(_fd, buffer.data(), buffer.size()))
+    {
+        for (uint64_t i = 0; i < n; i++)
+        {
+            char c = buffer[i];
+            if (is_digit_char(c) && state != AFTER)
+            {
+                state = DIGITS;
+                digits.push_back(c - '0');
+            }
+            else if (is_space_char(c) && !(state == DIGITS && digits.empty()))
+            {
+                state = state == BEFORE ? BEFORE : AFTER;
+            }
+            else if (c == '-' && state == BEFORE)
+            {
+                negative = true;
+                state = DIGITS;
+            }
+            else
+            {
+                throw infPrecision::not_numerical();
+            }
+        }
+    }
+
+    if (digits.empty())
+    {
+        throw infPrecision::not_numerical();
+    }
+    // If an integer which is not 0, has leading 0s, throw exception
+    if (digits[0] == 0 && digits.size() > 1)
+    {
+        throw infPrecision::cannot_leadZero();
+    }
+    if (negative)
+    {
+        digits[0] *= (-1);
+    }
+    return infPrecision(trusted, std::move(digits));
+}
+
+/**
+ * @brief Write the digits of a infPrecision object to a file descriptor in
+ * blocks of _block characters, straight from the stored vector
+ *
+ * @param _fd An open file descriptor
+ * @param _infP A infPrecision object
+ * @param _block The number of characters written at once
+ */
+void write_integer_fd(int _fd, const infPrecision &_infP, uint64_t _block)
+{
+    const vector<int64_t> &digits = _infP.digits();
+    string buffer;
+    buffer.reserve(min<uint64_t>(max<uint64_t>(_block, 1), digits.size() + 1));
+    if (_infP.is_negative())
+    {
+        buffer.push_back('-');
+    }
+    for (uint64_t i = 0; i < digits.size(); i++)
+    {
+        buffer.push_back('0' + infPrecision_detail::abs_digit(digits[i]));
+        if (buffer.size() >= _block)
+        {
+            infPrecision_detail::write_block(_fd, buffer.data(), buffer.size());
+            buffer.clear();
+        }
+    }
+    infPrecision_detail::write_block(_fd, buffer.data(), buffer.size());
+}
+
+#endif
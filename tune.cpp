@@ -0,0 +1,166 @@
+/**
+ * @file tune.cpp
+ * @brief Measure the crossover between the multiplication tiers on this
+ * machine, and write the thresholds into the header infPrecisionTuning.hpp,
+ * which infPrecision.hpp includes when it exists.
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2022
+ *
+ * Usage: tune [--output=PATH] [--min-time=SECONDS]
+ *
+ * Every candidate size is multiplied both by the schoolbook basecase and by
+ * one level of Karatsuba's method over the basecase. The threshold is the
+ * smallest size from which Karatsuba's method stays faster.
+ */
+
+#include <iostream>
+#include <fstream>
+#include <vector>
+#include <string>
+#include <chrono>
+#include <random>
+#include "infPrecision.hpp"
+using namespace std;
+
+mt19937_64 generator(20221019);
+volatile uint64_t sink = 0; // keeps the products alive
+
+/**
+ * @brief Make a random magnitude of _n full limbs
+ *
+ */
+vector<uint32_t> random_limbs(uint64_t _n)
+{
+    vector<uint32_t> limbs(_n);
+    for (uint32_t &limb : limbs)
+    {
+        limb = generator() % infPrecision_detail::LIMB_BASE;
+    }
+    limbs.back() = max<uint32_t>(limbs.back(), 1);
+    return limbs;
+}
+
+/**
+ * @brief Time one multiplication with a given threshold. The best of five
+ * rounds is taken, every round lasting at least _min_time / 5 seconds.
+ *
+ * @return double Nanoseconds per multiplication
+ */
+double time_mul(const vector<uint32_t> &_a, const vector<uint32_t> &_b, uint64_t _threshold, double _min_time)
+{
+    double best = 1e300;
+    for (int round = 0; round < 5; round++)
+    {
+        for (uint64_t iterations = 1;; iterations *= 2)
+        {
+            auto start = chrono::steady_clock::now();
+            for (uint64_t i = 0; i < iterations; i++)
+            {
+                sink = sink + infPrecision_detail::mul_limbs(_a, _b, _threshold).size();
+            }
+            double seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+            if (seconds >= _min_time / 5)
+            {
+                best = min(best, seconds * 1e9 / iterations);
+                break;
+            }
+        }
+    }
+    return best;
+}
+
+/**
+ * @brief Get the name of the CPU, or "unknown" where it cannot be read
+ *
+ */
+string cpu_name()
+{
+    ifstream cpuinfo("/proc/cpuinfo");
+    string line;
+    while (getline(cpuinfo, line))
+    {
+        if (line.compare(0, 10, "model name") == 0 && line.find(':') != string::npos)
+        {
+            return line.substr(line.find(':') + 2);
+        }
+    }
+    return "unknown";
+}
+
+int main(int argc, char **argv)
+{
+    string output = "infPrecisionTuning.hpp";
+    double min_time = 0.02;
+    for (int i = 1; i < argc; i++)
+    {
+        string arg = argv[i];
+        if (arg.compare(0, 9, "--output=") == 0)
+        {
+            output = arg.substr(9);
+        }
+        else if (arg.compare(0, 11, "--min-time=") == 0)
+        {
+            min_time = stod(arg.substr(11));
+        }
+        else
+        {
+            cerr << "Usage: tune [--output=PATH] [--min-time=SECONDS]\n";
+            return 1;
+        }
+    }
+
+    // Candidate sizes in limbs, and the time of both tiers for each
+    const vector<uint64_t> sizes = {8, 12, 16, 20, 24, 28, 32, 40, 48, 56, 64, 80, 96, 112, 128, 160, 192, 256};
+    vector<double> basecase(sizes.size()), karatsuba(sizes.size());
+    for (uint64_t i = 0; i < sizes.size(); i++)
+    {
+        vector<uint32_t> a = random_limbs(sizes[i]), b = random_limbs(sizes[i]);
+        // A threshold above the size keeps the basecase; a threshold equal
+        // to the size splits once, and the halves use the basecase
+        basecase[i] = time_mul(a, b, sizes[i] + 1, min_time);
+        karatsuba[i] = time_mul(a, b, sizes[i], min_time);
+        cerr << sizes[i] << " limbs: schoolbook " << basecase[i] << " ns, karatsuba " << karatsuba[i] << " ns\n";
+    }
+
+    // The smallest size from which Karatsuba's method is faster at every
+    // larger candidate
+    uint64_t threshold = sizes.back() * 2;
+    for (uint64_t i = sizes.size(); i-- > 0;)
+    {
+        if (karatsuba[i] >= basecase[i])
+        {
+            break;
+        }
+        threshold = sizes[i];
+    }
+
+    ofstream header(output);
+    if (!header)
+    {
+        cerr << "Cannot write " << output << "\n";
+        return 1;
+    }
+    header << "/**\n"
+           << " * @file infPrecisionTuning.hpp\n"
+           << " * @brief Thresholds of infPrecision measured on this machine, generated by\n"
+           << " * tune.cpp. Run the tuning program again after changing the CPU or the\n"
+           << " * compiler options.\n"
+           << " *\n"
+           << " * CPU: " << cpu_name() << "\n"
+           << " *\n"
+           << " */\n\n"
+           << "#ifndef INFPRECISIONTUNING_HPP\n"
+           << "#define INFPRECISIONTUNING_HPP\n\n"
+           << "// limbs  schoolbook (ns)  karatsuba (ns)\n";
+    for (uint64_t i = 0; i < sizes.size(); i++)
+    {
+        header << "// " << sizes[i] << "  " << basecase[i] << "  " << karatsuba[i] << "\n";
+    }
+    header << "#ifndef INFPRECISION_KARATSUBA_THRESHOLD\n"
+           << "#define INFPRECISION_KARATSUBA_THRESHOLD " << threshold << "\n"
+           << "#endif\n\n"
+           << "#endif\n";
+    cout << "INFPRECISION_KARATSUBA_THRESHOLD = " << threshold << ", written to " << output << "\n";
+}